@@ -72,11 +72,14 @@ SOURCES += \
 
 include(graph/graph.pri)
 include(graph.incidencelist/graph.incidencelist.pri)
+include(graph.static/graph.static.pri)
 include(graph.visitor/graph.visitor.pri)
 include(property/property.pri)
+include(parallel/parallel.pri)
 include(pipe/pipe.pri)
 include(io/io.pri)
 include(algorithm/algorithm.pri)
 include(algorithm.basic/algorithm.basic.pri)
 include(algorithm.basic.traversal/algorithm.basic.traversal.pri)
+include(algorithm.basic.shortestpath/algorithm.basic.shortestpath.pri)
 include(datastructure/datastructure.pri)
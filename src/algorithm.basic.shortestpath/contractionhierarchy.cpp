@@ -0,0 +1,530 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "contractionhierarchy.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "algorithm/digraphdispatch.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace Algora {
+
+namespace {
+
+typedef DiGraph::size_type size_type;
+typedef ContractionHierarchy::weight_type weight_type;
+
+// bounded Dijkstra searches for witness paths during contraction
+class WitnessSearch {
+public:
+    explicit WitnessSearch(size_type n)
+        : seen(n, 0U), targetOf(n, 0U), distance(n), epoch(0U), heap(n) { }
+
+    // Searches from source, avoiding skip, until all targets or all vertices
+    // within maxDistance or limit many vertices have been settled.
+    template<typename Neighbors>
+    void run(size_type source, size_type skip, const std::vector<size_type> &targets,
+             weight_type maxDistance, size_type limit, const Neighbors &forEachNeighbor) {
+        if (++epoch == 0U) {
+            std::fill(seen.begin(), seen.end(), 0U);
+            std::fill(targetOf.begin(), targetOf.end(), 0U);
+            epoch = 1U;
+        }
+        size_type remaining = 0U;
+        for (auto t : targets) {
+            if (t != source && targetOf[t] != epoch) {
+                targetOf[t] = epoch;
+                remaining++;
+            }
+        }
+        heap.clear();
+        seen[source] = epoch;
+        distance[source] = 0U;
+        heap.push(source, 0U);
+        size_type settled = 0U;
+        while (remaining > 0U && !heap.empty() && heap.topPriority() <= maxDistance && settled < limit) {
+            auto v = heap.top();
+            heap.pop();
+            settled++;
+            if (targetOf[v] == epoch) {
+                remaining--;
+            }
+            auto dv = distance[v];
+            forEachNeighbor(v, [&](size_type w, weight_type weight) {
+                if (w == skip) {
+                    return;
+                }
+                auto nd = dv + weight;
+                if (seen[w] != epoch) {
+                    seen[w] = epoch;
+                    distance[w] = nd;
+                    heap.push(w, nd);
+                } else if (nd < distance[w] && heap.contains(w)) {
+                    distance[w] = nd;
+                    heap.decrease(w, nd);
+                }
+            });
+        }
+    }
+
+    // length of some path found to v, or INF
+    weight_type upperBound(size_type v) const {
+        return seen[v] == epoch ? distance[v] : ContractionHierarchy::INF;
+    }
+
+private:
+    std::vector<unsigned> seen;
+    std::vector<unsigned> targetOf;
+    std::vector<weight_type> distance;
+    unsigned epoch;
+    AddressableDAryHeap<weight_type, 4U> heap;
+};
+
+}
+
+constexpr weight_type ContractionHierarchy::INF;
+constexpr size_type ContractionHierarchy::NONE;
+
+ContractionHierarchy::ContractionHierarchy()
+    : DiGraphAlgorithm(), weights(nullptr), witnessLimit(500U), built(false), numShortcuts(0U)
+{
+
+}
+
+ContractionHierarchy::~ContractionHierarchy()
+{
+
+}
+
+weight_type ContractionHierarchy::getDistance(const Vertex *source, const Vertex *target)
+{
+    if (!query) {
+        query.reset(new ContractionHierarchyQuery(*this));
+    }
+    return query->run(source, target);
+}
+
+std::vector<Arc*> ContractionHierarchy::getArcsOnPath(const Vertex *source, const Vertex *target)
+{
+    getDistance(source, target);
+    return query->getArcsOnPath();
+}
+
+void ContractionHierarchy::run()
+{
+    reset();
+    if (hasCompactVertexIds(diGraph)) {
+        indexOf.reset(new FastPropertyMap<size_type>(NONE));
+    } else {
+        indexOf.reset(new PropertyMap<size_type>(NONE));
+    }
+    size_type n = 0U;
+    diGraph->mapVertices([this,&n](Vertex *v) { indexOf->setValue(v, n++); });
+
+    diGraph->mapArcs([this](Arc *a) {
+        auto tail = (*indexOf)(a->getTail());
+        auto head = (*indexOf)(a->getHead());
+        if (tail != head) {
+            edges.push_back(Edge { tail, head, weights ? (*weights)(a) : a->getSize(),
+                                   NONE, NONE, a });
+        }
+    });
+    // of parallel arcs, only the lightest one is relevant
+    std::sort(edges.begin(), edges.end(), [](const Edge &l, const Edge &r) {
+        return l.tail != r.tail ? l.tail < r.tail
+                                : (l.head != r.head ? l.head < r.head : l.weight < r.weight);
+    });
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const Edge &l, const Edge &r) {
+        return l.tail == r.tail && l.head == r.head;
+    }), edges.end());
+
+    contract(n);
+    built = true;
+}
+
+void ContractionHierarchy::contract(size_type n)
+{
+    std::vector<std::vector<size_type>> out(n);
+    std::vector<std::vector<size_type>> in(n);
+    for (size_type e = 0U; e < edges.size(); e++) {
+        out[edges[e].tail].push_back(e);
+        in[edges[e].head].push_back(e);
+    }
+    std::vector<bool> contracted(n, false);
+    // edges superseded by a lighter shortcut, which queries do not need
+    std::vector<bool> replaced(edges.size(), false);
+    std::vector<size_type> rank(n, NONE);
+    std::vector<long long> contractedNeighbors(n, 0);
+    WitnessSearch witness(n);
+
+    auto forEachOut = [&](size_type v, auto &&f) {
+        for (auto e : out[v]) {
+            if (!contracted[edges[e].head]) {
+                f(edges[e].head, edges[e].weight);
+            }
+        }
+    };
+
+    // calls f(u, w, weight, e1, e2) for each shortcut required by contracting v
+    std::vector<size_type> targets;
+    auto shortcuts = [&](size_type v, auto &&f) {
+        weight_type maxOut = 0U;
+        targets.clear();
+        for (auto e2 : out[v]) {
+            if (!contracted[edges[e2].head]) {
+                targets.push_back(edges[e2].head);
+                maxOut = std::max(maxOut, edges[e2].weight);
+            }
+        }
+        for (auto e1 : in[v]) {
+            auto u = edges[e1].tail;
+            if (contracted[u]) {
+                continue;
+            }
+            witness.run(u, v, targets, edges[e1].weight + maxOut, witnessLimit, forEachOut);
+            for (auto e2 : out[v]) {
+                auto w = edges[e2].head;
+                if (contracted[w] || w == u) {
+                    continue;
+                }
+                auto via = edges[e1].weight + edges[e2].weight;
+                if (witness.upperBound(w) > via) {
+                    f(u, w, via, e1, e2);
+                }
+            }
+        }
+    };
+
+    auto liveDegree = [&](size_type v) {
+        long long d = 0;
+        for (auto e : out[v]) {
+            d += !contracted[edges[e].head];
+        }
+        for (auto e : in[v]) {
+            d += !contracted[edges[e].tail];
+        }
+        return d;
+    };
+
+    struct Shortcut {
+        size_type u;
+        size_type w;
+        weight_type via;
+        size_type e1;
+        size_type e2;
+    };
+    // shortcuts required by contracting v, as of the last call of collect(v)
+    std::vector<Shortcut> pending;
+    auto collect = [&](size_type v) {
+        pending.clear();
+        shortcuts(v, [&pending](size_type u, size_type w, weight_type via, size_type e1, size_type e2) {
+            pending.push_back(Shortcut { u, w, via, e1, e2 });
+        });
+    };
+
+    // edge difference, plus terms that spread contraction evenly over the graph;
+    // the shortcuts are counted with the same witness limit as used for contraction
+    std::vector<long long> level(n, 0);
+    auto priority = [&](size_type v) {
+        collect(v);
+        auto added = static_cast<long long>(pending.size());
+        return 2 * (added - liveDegree(v)) + contractedNeighbors[v] + level[v];
+    };
+
+    AddressableDAryHeap<long long, 4U> queue(n);
+    for (size_type v = 0U; v < n; v++) {
+        queue.push(v, priority(v));
+    }
+
+    size_type nextRank = 0U;
+    while (!queue.empty()) {
+        auto v = queue.top();
+        queue.pop();
+        // priorities are updated lazily
+        auto p = priority(v);
+        if (!queue.empty() && p > queue.topPriority()) {
+            queue.push(v, p);
+            continue;
+        }
+        // the shortcuts just counted are those to insert
+        for (const auto &s : pending) {
+            auto existing = std::find_if(out[s.u].begin(), out[s.u].end(), [&](size_type e) {
+                return edges[e].head == s.w;
+            });
+            if (existing != out[s.u].end()) {
+                if (edges[*existing].weight <= s.via) {
+                    continue;
+                }
+                // earlier shortcuts may consist of the heavier edge, so it is kept
+                // unchanged for unpacking and only leaves the remaining graph
+                auto e = *existing;
+                replaced[e] = true;
+                out[s.u].erase(existing);
+                in[s.w].erase(std::find(in[s.w].begin(), in[s.w].end(), e));
+            }
+            out[s.u].push_back(edges.size());
+            in[s.w].push_back(edges.size());
+            edges.push_back(Edge { s.u, s.w, s.via, s.e1, s.e2, nullptr });
+            replaced.push_back(false);
+            numShortcuts++;
+        }
+        contracted[v] = true;
+        rank[v] = nextRank++;
+        std::vector<size_type> neighbors;
+        for (auto e : out[v]) {
+            neighbors.push_back(edges[e].head);
+        }
+        for (auto e : in[v]) {
+            neighbors.push_back(edges[e].tail);
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        for (auto x : neighbors) {
+            if (contracted[x]) {
+                continue;
+            }
+            // drop edges to contracted vertices from the remaining graph
+            out[x].erase(std::remove_if(out[x].begin(), out[x].end(), [&](size_type e) {
+                return contracted[edges[e].head];
+            }), out[x].end());
+            in[x].erase(std::remove_if(in[x].begin(), in[x].end(), [&](size_type e) {
+                return contracted[edges[e].tail];
+            }), in[x].end());
+            contractedNeighbors[x]++;
+            level[x] = std::max(level[x], level[v] + 1);
+        }
+        std::vector<size_type>().swap(out[v]);
+        std::vector<size_type>().swap(in[v]);
+    }
+
+    // upward edges by tail, downward edges by head
+    upOffsets.assign(n + 1U, 0U);
+    downOffsets.assign(n + 1U, 0U);
+    for (size_type e = 0U; e < edges.size(); e++) {
+        if (replaced[e]) {
+            continue;
+        }
+        if (rank[edges[e].tail] < rank[edges[e].head]) {
+            upOffsets[edges[e].tail + 1U]++;
+        } else {
+            downOffsets[edges[e].head + 1U]++;
+        }
+    }
+    for (size_type v = 0U; v < n; v++) {
+        upOffsets[v + 1U] += upOffsets[v];
+        downOffsets[v + 1U] += downOffsets[v];
+    }
+    upEdges.resize(upOffsets[n]);
+    downEdges.resize(downOffsets[n]);
+    std::vector<size_type> upPos(upOffsets.begin(), upOffsets.end() - 1);
+    std::vector<size_type> downPos(downOffsets.begin(), downOffsets.end() - 1);
+    for (size_type e = 0U; e < edges.size(); e++) {
+        if (replaced[e]) {
+            continue;
+        }
+        if (rank[edges[e].tail] < rank[edges[e].head]) {
+            upEdges[upPos[edges[e].tail]++] = e;
+        } else {
+            downEdges[downPos[edges[e].head]++] = e;
+        }
+    }
+}
+
+void ContractionHierarchy::unpack(size_type edge, std::vector<Arc*> &path) const
+{
+    std::vector<size_type> stack { edge };
+    while (!stack.empty()) {
+        const Edge &e = edges[stack.back()];
+        stack.pop_back();
+        if (e.first == NONE) {
+            path.push_back(e.arc);
+        } else {
+            stack.push_back(e.second);
+            stack.push_back(e.first);
+        }
+    }
+}
+
+std::string ContractionHierarchy::getProfilingInfo() const
+{
+    std::stringstream ss;
+    ss << "#shortcuts: " << numShortcuts << std::endl;
+    ss << "#upward edges: " << upEdges.size() << std::endl;
+    ss << "#downward edges: " << downEdges.size() << std::endl;
+    return ss.str();
+}
+
+void ContractionHierarchy::onDiGraphSet()
+{
+    reset();
+}
+
+void ContractionHierarchy::onDiGraphUnset()
+{
+    reset();
+}
+
+void ContractionHierarchy::reset()
+{
+    built = false;
+    numShortcuts = 0U;
+    indexOf.reset();
+    edges.clear();
+    upOffsets.clear();
+    upEdges.clear();
+    downOffsets.clear();
+    downEdges.clear();
+    query.reset();
+}
+
+ContractionHierarchyQuery::ContractionHierarchyQuery(const ContractionHierarchy &ch)
+    : ch(ch), epoch(0U), distance(ContractionHierarchy::INF), meeting(ContractionHierarchy::NONE),
+      source(ContractionHierarchy::NONE), target(ContractionHierarchy::NONE), numSettled(0U)
+{
+
+}
+
+void ContractionHierarchyQuery::init(Side &side, size_type n)
+{
+    if (side.seen.size() != n) {
+        side.seen.assign(n, 0U);
+        side.distance.resize(n);
+        side.parentEdge.resize(n);
+        side.heap = AddressableDAryHeap<weight_type, 4U>(n);
+    } else {
+        side.heap.clear();
+    }
+}
+
+weight_type ContractionHierarchyQuery::run(const Vertex *s, const Vertex *t)
+{
+    auto n = ch.upOffsets.empty() ? 0U : ch.upOffsets.size() - 1U;
+    init(forward, n);
+    init(backward, n);
+    if (++epoch == 0U) {
+        std::fill(forward.seen.begin(), forward.seen.end(), 0U);
+        std::fill(backward.seen.begin(), backward.seen.end(), 0U);
+        epoch = 1U;
+    }
+    distance = ContractionHierarchy::INF;
+    meeting = ContractionHierarchy::NONE;
+    numSettled = 0U;
+    source = ContractionHierarchy::NONE;
+    target = ContractionHierarchy::NONE;
+    if (!ch.built || !ch.diGraph->containsVertex(s) || !ch.diGraph->containsVertex(t)) {
+        return distance;
+    }
+    source = (*ch.indexOf)(s);
+    target = (*ch.indexOf)(t);
+    // vertices added after the hierarchy was built
+    if (source >= n || target >= n) {
+        return distance;
+    }
+
+    auto start = [this](Side &side, size_type v) {
+        side.seen[v] = epoch;
+        side.distance[v] = 0U;
+        side.parentEdge[v] = ContractionHierarchy::NONE;
+        side.heap.push(v, 0U);
+    };
+    start(forward, source);
+    start(backward, target);
+
+    auto step = [this](Side &side, Side &other, const std::vector<size_type> &offsets,
+                       const std::vector<size_type> &edgeIds,
+                       const std::vector<size_type> &oppositeOffsets,
+                       const std::vector<size_type> &oppositeEdgeIds, bool up) {
+        auto v = side.heap.top();
+        side.heap.pop();
+        numSettled++;
+        auto dv = side.distance[v];
+        if (other.seen[v] == epoch && dv + other.distance[v] < distance) {
+            distance = dv + other.distance[v];
+            meeting = v;
+        }
+        // stall-on-demand: v is not on a shortest path if a higher vertex
+        // that has been reached offers a shorter way to it
+        for (auto k = oppositeOffsets[v]; k < oppositeOffsets[v + 1U]; k++) {
+            const auto &e = ch.edges[oppositeEdgeIds[k]];
+            auto x = up ? e.tail : e.head;
+            if (side.seen[x] == epoch && side.distance[x] + e.weight < dv) {
+                return;
+            }
+        }
+        for (auto k = offsets[v]; k < offsets[v + 1U]; k++) {
+            const auto &e = ch.edges[edgeIds[k]];
+            auto w = up ? e.head : e.tail;
+            auto nd = dv + e.weight;
+            if (side.seen[w] != epoch) {
+                side.seen[w] = epoch;
+                side.distance[w] = nd;
+                side.parentEdge[w] = edgeIds[k];
+                side.heap.push(w, nd);
+            } else if (nd < side.distance[w] && side.heap.contains(w)) {
+                side.distance[w] = nd;
+                side.parentEdge[w] = edgeIds[k];
+                side.heap.decrease(w, nd);
+            }
+        }
+    };
+
+    while (true) {
+        bool forwardActive = !forward.heap.empty() && forward.heap.topPriority() < distance;
+        bool backwardActive = !backward.heap.empty() && backward.heap.topPriority() < distance;
+        if (!forwardActive && !backwardActive) {
+            break;
+        }
+        if (forwardActive && (!backwardActive
+                              || forward.heap.topPriority() <= backward.heap.topPriority())) {
+            step(forward, backward, ch.upOffsets, ch.upEdges, ch.downOffsets, ch.downEdges, true);
+        } else {
+            step(backward, forward, ch.downOffsets, ch.downEdges, ch.upOffsets, ch.upEdges, false);
+        }
+    }
+    return distance;
+}
+
+std::vector<Arc*> ContractionHierarchyQuery::getArcsOnPath() const
+{
+    std::vector<Arc*> path;
+    if (!hasPath()) {
+        return path;
+    }
+    std::vector<size_type> upward;
+    for (auto v = meeting; v != source; v = ch.edges[forward.parentEdge[v]].tail) {
+        upward.push_back(forward.parentEdge[v]);
+    }
+    for (auto it = upward.rbegin(); it != upward.rend(); ++it) {
+        ch.unpack(*it, path);
+    }
+    for (auto v = meeting; v != target; v = ch.edges[backward.parentEdge[v]].head) {
+        ch.unpack(backward.parentEdge[v], path);
+    }
+    return path;
+}
+
+}
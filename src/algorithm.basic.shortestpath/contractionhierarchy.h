@@ -0,0 +1,169 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef CONTRACTIONHIERARCHY_H
+#define CONTRACTIONHIERARCHY_H
+
+#include "algorithm/digraphalgorithm.h"
+#include "graph/digraph.h"
+#include "datastructure/addressabledaryheap.h"
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Algora {
+
+class Vertex;
+class Arc;
+
+template<typename T>
+class Property;
+template<typename T>
+class ModifiableProperty;
+
+class ContractionHierarchyQuery;
+
+/**
+ * Contraction hierarchy for repeated point-to-point shortest path queries
+ * on a static graph with nonnegative integral arc weights (by default, the
+ * arc sizes as in ShortestPathAlgorithm).
+ * run() contracts the vertices one by one in the order of a lazily updated
+ * edge difference, inserting shortcuts where no witness path exists, and
+ * stores upward and downward arcs in CSR layout.
+ * Queries are answered by a bidirectional Dijkstra search on the upward
+ * arcs, see ContractionHierarchyQuery.
+ * The hierarchy reflects the graph at the time of the last run().
+ */
+class ContractionHierarchy : public DiGraphAlgorithm
+{
+public:
+    typedef DiGraph::size_type weight_type;
+    static constexpr weight_type INF = std::numeric_limits<weight_type>::max();
+    static constexpr DiGraph::size_type NONE = std::numeric_limits<DiGraph::size_type>::max();
+
+    ContractionHierarchy();
+    virtual ~ContractionHierarchy() override;
+
+    // nullptr reverts to arc sizes
+    void setArcWeights(const Property<weight_type> *w) { weights = w; }
+    // witness searches give up after settling this many vertices
+    void setWitnessSearchLimit(DiGraph::size_type limit) { witnessLimit = limit; }
+
+    bool isBuilt() const { return built; }
+    DiGraph::size_type getNumShortcuts() const { return numShortcuts; }
+
+    // convenience queries, sharing one ContractionHierarchyQuery; not thread-safe
+    weight_type getDistance(const Vertex *source, const Vertex *target);
+    std::vector<Arc*> getArcsOnPath(const Vertex *source, const Vertex *target);
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Contraction Hierarchy"; }
+    virtual std::string getShortName() const noexcept override { return "CH"; }
+    virtual std::string getProfilingInfo() const override;
+
+protected:
+    virtual void onDiGraphSet() override;
+    virtual void onDiGraphUnset() override;
+
+private:
+    friend class ContractionHierarchyQuery;
+
+    struct Edge {
+        DiGraph::size_type tail;
+        DiGraph::size_type head;
+        weight_type weight;
+        // for shortcuts, the two edges it consists of; NONE otherwise
+        DiGraph::size_type first;
+        DiGraph::size_type second;
+        Arc *arc;
+    };
+
+    const Property<weight_type> *weights;
+    DiGraph::size_type witnessLimit;
+    bool built;
+    DiGraph::size_type numShortcuts;
+
+    std::unique_ptr<ModifiableProperty<DiGraph::size_type>> indexOf;
+    std::vector<Edge> edges;
+    // upward edges by tail, and edges to lower vertices by head, i.e.,
+    // upward edges of the reverse graph
+    std::vector<DiGraph::size_type> upOffsets;
+    std::vector<DiGraph::size_type> upEdges;
+    std::vector<DiGraph::size_type> downOffsets;
+    std::vector<DiGraph::size_type> downEdges;
+
+    std::unique_ptr<ContractionHierarchyQuery> query;
+
+    void reset();
+    void contract(DiGraph::size_type n);
+    void unpack(DiGraph::size_type edge, std::vector<Arc*> &path) const;
+};
+
+/**
+ * Bidirectional upward search in a ContractionHierarchy.
+ * Each instance has its own search state, so that one instance per thread
+ * may query the same hierarchy concurrently.
+ */
+class ContractionHierarchyQuery
+{
+public:
+    typedef ContractionHierarchy::weight_type weight_type;
+
+    explicit ContractionHierarchyQuery(const ContractionHierarchy &ch);
+
+    // returns the distance from source to target, or ContractionHierarchy::INF;
+    // also INF if the hierarchy has not been built or does not know source or target
+    weight_type run(const Vertex *source, const Vertex *target);
+
+    bool hasPath() const { return distance != ContractionHierarchy::INF; }
+    weight_type getDistance() const { return distance; }
+    // the arcs of a shortest path found by the last run(), in the original graph
+    std::vector<Arc*> getArcsOnPath() const;
+    DiGraph::size_type getNumVerticesSettled() const { return numSettled; }
+
+private:
+    struct Side {
+        std::vector<unsigned> seen;
+        std::vector<weight_type> distance;
+        std::vector<DiGraph::size_type> parentEdge;
+        AddressableDAryHeap<weight_type, 4U> heap;
+    };
+
+    const ContractionHierarchy &ch;
+    Side forward;
+    Side backward;
+    unsigned epoch;
+    weight_type distance;
+    DiGraph::size_type meeting;
+    DiGraph::size_type source;
+    DiGraph::size_type target;
+    DiGraph::size_type numSettled;
+
+    void init(Side &side, DiGraph::size_type n);
+};
+
+}
+
+#endif // CONTRACTIONHIERARCHY_H
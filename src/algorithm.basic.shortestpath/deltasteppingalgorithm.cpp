@@ -0,0 +1,267 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "deltasteppingalgorithm.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "graph.static/staticdigraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "algorithm/digraphdispatch.h"
+#include "datastructure/circularbucketlist.h"
+#include "parallel/threadpool.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+
+#include <atomic>
+#include <vector>
+
+namespace Algora {
+
+namespace {
+
+typedef DiGraph::size_type size_type;
+typedef ShortestPathAlgorithm::weight_type weight_type;
+
+struct alignas(64) Requests {
+    // improved vertices, with the distance they were improved to
+    std::vector<std::pair<size_type, weight_type>> improved;
+};
+
+}
+
+DeltaSteppingAlgorithm::DeltaSteppingAlgorithm(bool computeValues)
+    : ShortestPathAlgorithm(computeValues), delta(0U), usedDelta(0U),
+      numThreads(0U), pool(nullptr), sequentialThreshold(256U)
+{
+
+}
+
+DeltaSteppingAlgorithm::~DeltaSteppingAlgorithm()
+{
+
+}
+
+void DeltaSteppingAlgorithm::setNumThreads(unsigned n)
+{
+    numThreads = n;
+    ownPool.reset();
+}
+
+ThreadPool &DeltaSteppingAlgorithm::threadPool()
+{
+    if (pool) {
+        return *pool;
+    }
+    if (!ownPool) {
+        ownPool.reset(new ThreadPool(numThreads));
+    }
+    return *ownPool;
+}
+
+void DeltaSteppingAlgorithm::run()
+{
+    resetSlots();
+    weight_type maxW = 0U;
+    diGraph->mapArcs([this,&maxW](Arc *a) {
+        auto w = weightOf(a);
+        if (w > maxW) {
+            maxW = w;
+        }
+    });
+    usedDelta = delta;
+    if (usedDelta == 0U) {
+        auto n = diGraph->getSize();
+        auto m = diGraph->getNumArcs(true);
+        usedDelta = m > n ? maxW * n / m : maxW;
+        if (usedDelta == 0U) {
+            usedDelta = 1U;
+        }
+    }
+
+    auto arcWeight = [this](const Arc *a) { return weightOf(a); };
+    auto sameArc = [](Arc *a) { return a; };
+    if (auto *ilGraph = dynamic_cast<IncidenceListGraph*>(diGraph)) {
+        search(ilGraph, maxW, source, target, arcWeight, sameArc);
+    } else if (auto *staticGraph = dynamic_cast<StaticDiGraph*>(diGraph)) {
+        search(staticGraph, maxW, source, target, arcWeight, sameArc);
+    } else {
+        PropertyMap<GraphArtifact*> otherToThis(nullptr);
+        FastPropertyMap<GraphArtifact*> thisToOtherVertices(nullptr);
+        FastPropertyMap<GraphArtifact*> thisToOtherArcs(nullptr);
+        StaticDiGraph snapshot;
+        snapshot.assign(diGraph, &otherToThis, nullptr, &thisToOtherVertices, &thisToOtherArcs);
+        // snapshot arc ids are positions in the outgoing arc array
+        std::vector<weight_type> snapshotWeights(snapshot.getNumArcs(true));
+        for (size_type k = 0U; k < snapshotWeights.size(); k++) {
+            snapshotWeights[k] = weightOf(static_cast<Arc*>(thisToOtherArcs(snapshot.outgoingArcAt(k))));
+        }
+        search(&snapshot, maxW, static_cast<Vertex*>(otherToThis(source)),
+               target ? static_cast<Vertex*>(otherToThis(target)) : nullptr,
+               [&snapshotWeights](const Arc *a) { return snapshotWeights[a->getId()]; },
+               [&thisToOtherArcs](Arc *a) { return static_cast<Arc*>(thisToOtherArcs(a)); });
+        for (auto &v : slotVertex) {
+            v = static_cast<Vertex*>(thisToOtherVertices(v));
+        }
+    }
+    storeResults();
+}
+
+template<typename GraphType, typename ArcWeight, typename ArcMap>
+void DeltaSteppingAlgorithm::search(GraphType *graph, weight_type maxW, const Vertex *s, const Vertex *t,
+                                    const ArcWeight &arcWeight, const ArcMap &arcMap)
+{
+    const size_type n = graph->getSize();
+    const weight_type width = usedDelta;
+    std::unique_ptr<std::atomic<weight_type>[]> dist(new std::atomic<weight_type>[n]);
+    // light phase in which a vertex was last taken from a bucket
+    std::vector<size_type> takenInStep(n, INF);
+    // bucket in which a vertex has been settled
+    std::vector<size_type> settledInBucket(n, INF);
+
+    ThreadPool *tp = nullptr;
+    std::vector<Requests> requests(1U);
+    auto forAll = [&](size_type count, auto &&f) {
+        if (count < sequentialThreshold) {
+            for (size_type i = 0U; i < count; i++) {
+                f(0U, i);
+            }
+            return 1U;
+        }
+        if (!tp) {
+            tp = &threadPool();
+            requests.resize(tp->getNumThreads());
+        }
+        tp->run([&](unsigned thread) {
+            for (auto i = tp->chunkBegin(0U, count, thread), e = tp->chunkBegin(0U, count, thread + 1U);
+                 i < e; i++) {
+                f(thread, i);
+            }
+        });
+        return tp->getNumThreads();
+    };
+    forAll(n, [&dist](unsigned, size_type i) { dist[i].store(INF, std::memory_order_relaxed); });
+
+    // a relaxation reaches at most maxW / width + 1 buckets ahead
+    CircularBucketList<size_type> buckets(maxW / width + 2U);
+    size_type queued = 0U;
+
+    auto si = vertexIndexOf(graph, s);
+    dist[si].store(0U, std::memory_order_relaxed);
+    buckets.front().push_back(si);
+    queued++;
+
+    std::vector<size_type> frontier;
+    std::vector<size_type> settledNow;
+    size_type phase = 0U;
+    size_type step = 0U;
+
+    auto relax = [&](const std::vector<size_type> &vertices, bool light) {
+        for (auto &r : requests) {
+            r.improved.clear();
+        }
+        auto used = forAll(vertices.size(), [&](unsigned thread, size_type i) {
+            auto v = vertices[i];
+            auto dv = dist[v].load(std::memory_order_relaxed);
+            graph->forEachOutgoing(graph->vertexAt(v), [&](Arc *a) {
+                auto w = arcWeight(a);
+                if ((w <= width) != light) {
+                    return;
+                }
+                auto h = vertexIndexOf(graph, a->getHead());
+                auto nd = dv + w;
+                auto old = dist[h].load(std::memory_order_relaxed);
+                while (nd < old) {
+                    if (dist[h].compare_exchange_weak(old, nd, std::memory_order_relaxed)) {
+                        requests[thread].improved.emplace_back(h, nd);
+                        break;
+                    }
+                }
+            });
+        });
+        for (unsigned thread = 0U; thread < used; thread++) {
+            for (const auto &r : requests[thread].improved) {
+                // skip requests that have been superseded by a shorter distance
+                if (dist[r.first].load(std::memory_order_relaxed) == r.second) {
+                    buckets[r.second / width - phase].push_back(r.first);
+                    queued++;
+                }
+            }
+        }
+    };
+
+    auto ti = t ? vertexIndexOf(graph, t) : INF;
+    for (; queued > 0U; phase++, buckets.shift()) {
+        settledNow.clear();
+        auto &bucket = buckets.front();
+        // light phases
+        while (!bucket.empty()) {
+            frontier.clear();
+            for (auto v : bucket) {
+                if (dist[v].load(std::memory_order_relaxed) / width == phase
+                        && takenInStep[v] != step) {
+                    takenInStep[v] = step;
+                    frontier.push_back(v);
+                    if (settledInBucket[v] != phase) {
+                        settledInBucket[v] = phase;
+                        settledNow.push_back(v);
+                    }
+                }
+            }
+            queued -= bucket.size();
+            bucket.clear();
+            relax(frontier, true);
+            step++;
+        }
+        relax(settledNow, false);
+        for (auto v : settledNow) {
+            auto slot = addSlot(graph->vertexAt(v), dist[v].load(std::memory_order_relaxed), nullptr);
+            slotSettled[slot] = true;
+        }
+        numSettled += settledNow.size();
+        if (ti != INF && settledInBucket[ti] == phase) {
+            targetDistance = dist[ti].load(std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    if (predecessors) {
+        forAll(slotVertex.size(), [&](unsigned, size_type i) {
+            auto v = slotVertex[i];
+            auto dv = slotDistance[i];
+            if (dv == 0U && v == s) {
+                return;
+            }
+            graph->forEachIncoming(v, [&](Arc *a) {
+                auto tail = vertexIndexOf(graph, a->getTail());
+                auto dt = dist[tail].load(std::memory_order_relaxed);
+                if (dt != INF && settledInBucket[tail] != INF && dt + arcWeight(a) == dv) {
+                    slotPredecessor[i] = arcMap(a);
+                    return false;
+                }
+                return true;
+            });
+        });
+    }
+}
+
+}
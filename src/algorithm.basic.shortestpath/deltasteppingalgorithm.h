@@ -0,0 +1,85 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef DELTASTEPPINGALGORITHM_H
+#define DELTASTEPPINGALGORITHM_H
+
+#include "shortestpathalgorithm.h"
+
+#include <memory>
+
+namespace Algora {
+
+class ThreadPool;
+
+/**
+ * Parallel delta-stepping (Meyer and Sanders).
+ * Vertices are kept in buckets of width delta; the vertices of the lowest
+ * nonempty bucket are relaxed in parallel, first along light arcs
+ * (weight <= delta) until the bucket stays empty, then along heavy arcs.
+ * Relaxations are atomic; improved vertices are collected in thread-local
+ * buffers and moved into their buckets afterwards.
+ * Graphs without dense vertex indices are searched on a StaticDiGraph snapshot.
+ * Predecessor arcs are determined after the search; in the presence of
+ * cycles of zero weight, they need not form a tree.
+ */
+class DeltaSteppingAlgorithm : public ShortestPathAlgorithm
+{
+public:
+    explicit DeltaSteppingAlgorithm(bool computeValues = true);
+    virtual ~DeltaSteppingAlgorithm() override;
+
+    // 0 chooses delta as the maximum arc weight divided by the average out-degree
+    void setDelta(weight_type d) { delta = d; }
+    weight_type getDelta() const { return usedDelta; }
+
+    // 0 uses all hardware threads
+    void setNumThreads(unsigned n);
+    // use an external pool instead of an own one; nullptr reverts to an own pool
+    void useThreadPool(ThreadPool *threadPool) { pool = threadPool; }
+    // buckets with fewer vertices are relaxed by the calling thread alone
+    void setSequentialThreshold(DiGraph::size_type t) { sequentialThreshold = t; }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Delta-Stepping"; }
+    virtual std::string getShortName() const noexcept override { return "delta-stepping"; }
+
+private:
+    weight_type delta;
+    weight_type usedDelta;
+    unsigned numThreads;
+    ThreadPool *pool;
+    std::unique_ptr<ThreadPool> ownPool;
+    DiGraph::size_type sequentialThreshold;
+
+    ThreadPool &threadPool();
+    // arcWeight gives the weight of an arc of graph, arcMap the corresponding arc of diGraph
+    template<typename GraphType, typename ArcWeight, typename ArcMap>
+    void search(GraphType *graph, weight_type maxW, const Vertex *s, const Vertex *t,
+                const ArcWeight &arcWeight, const ArcMap &arcMap);
+};
+
+}
+
+#endif // DELTASTEPPINGALGORITHM_H
@@ -0,0 +1,107 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "dialalgorithm.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "algorithm/digraphdispatch.h"
+
+#include <stdexcept>
+
+namespace Algora {
+
+template <template<typename T> class ModifiablePropertyType>
+constexpr DiGraph::size_type DialAlgorithm<ModifiablePropertyType>::NONE;
+
+template <template<typename T> class ModifiablePropertyType>
+void DialAlgorithm<ModifiablePropertyType>::run()
+{
+    resetSlots();
+    slotOf.resetAll();
+    weight_type maxW = maxWeight;
+    if (maxW == 0U) {
+        diGraph->mapArcs([this,&maxW](Arc *a) {
+            auto w = weightOf(a);
+            if (w > maxW) {
+                maxW = w;
+            }
+        });
+    }
+    dispatchDiGraph(diGraph, [this,maxW](auto *graph) { search(graph, maxW); });
+    storeResults();
+}
+
+template <template<typename T> class ModifiablePropertyType>
+template <typename GraphType>
+void DialAlgorithm<ModifiablePropertyType>::search(GraphType *graph, weight_type maxW)
+{
+    buckets.resize(maxW + 1U);
+    for (DiGraph::size_type i = 0U; i < buckets.size(); i++) {
+        buckets[i].clear();
+    }
+
+    Vertex *s = const_cast<Vertex*>(source);
+    slotOf[s] = addSlot(s, 0U, nullptr);
+    buckets.front().push_back(0U);
+    // entries in buckets, including outdated ones
+    DiGraph::size_type queued = 1U;
+
+    for (weight_type d = 0U; queued > 0U; d++, buckets.shift()) {
+        auto &bucket = buckets.front();
+        while (!bucket.empty()) {
+            auto slot = bucket.back();
+            bucket.pop_back();
+            queued--;
+            if (slotSettled[slot] || slotDistance[slot] != d) {
+                continue;
+            }
+            if (settle(slot)) {
+                return;
+            }
+            graph->forEachOutgoing(slotVertex[slot], [&](Arc *a) {
+                auto w = weightOf(a);
+                if (w > maxW) {
+                    throw std::invalid_argument("Arc weight exceeds the maximum arc weight.");
+                }
+                Vertex *head = a->getHead();
+                weight_type nd = d + w;
+                auto &headSlot = slotOf[head];
+                if (headSlot == NONE) {
+                    headSlot = addSlot(head, nd, a);
+                } else if (!slotSettled[headSlot] && nd < slotDistance[headSlot]) {
+                    slotDistance[headSlot] = nd;
+                    slotPredecessor[headSlot] = a;
+                } else {
+                    return;
+                }
+                buckets[w].push_back(headSlot);
+                queued++;
+            });
+        }
+    }
+}
+
+template class DialAlgorithm<PropertyMap>;
+template class DialAlgorithm<FastPropertyMap>;
+
+}
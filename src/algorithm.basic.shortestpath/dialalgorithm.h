@@ -0,0 +1,74 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef DIALALGORITHM_H
+#define DIALALGORITHM_H
+
+#include "shortestpathalgorithm.h"
+#include "datastructure/circularbucketlist.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "property/traversalpropertymap.h"
+
+namespace Algora {
+
+/**
+ * Dial's algorithm: Dijkstra with a circular array of maxWeight + 1
+ * distance buckets.
+ * Runs in O(m + n * maxWeight) and is preferable to a heap if the
+ * maximum arc weight is small.
+ * Unless set explicitly, the maximum weight is determined by a pass over all arcs.
+ */
+template <template<typename T> class ModifiablePropertyType = PropertyMap>
+class DialAlgorithm : public ShortestPathAlgorithm
+{
+public:
+    explicit DialAlgorithm(bool computeValues = true)
+        : ShortestPathAlgorithm(computeValues), maxWeight(0U), slotOf(NONE), buckets(1U) { }
+    virtual ~DialAlgorithm() override = default;
+
+    // 0 determines the maximum weight on each run
+    void setMaxArcWeight(weight_type w) { maxWeight = w; }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Dial"; }
+    virtual std::string getShortName() const noexcept override { return "dial"; }
+
+private:
+    static constexpr DiGraph::size_type NONE = std::numeric_limits<DiGraph::size_type>::max();
+
+    weight_type maxWeight;
+    typename TraversalPropertyMap<ModifiablePropertyType, DiGraph::size_type>::type slotOf;
+    CircularBucketList<DiGraph::size_type> buckets;
+
+    template<typename GraphType>
+    void search(GraphType *graph, weight_type maxW);
+};
+
+extern template class DialAlgorithm<PropertyMap>;
+extern template class DialAlgorithm<FastPropertyMap>;
+
+}
+
+#endif // DIALALGORITHM_H
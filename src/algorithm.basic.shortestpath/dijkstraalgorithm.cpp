@@ -0,0 +1,80 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "dijkstraalgorithm.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "algorithm/digraphdispatch.h"
+
+namespace Algora {
+
+template <template<typename T> class ModifiablePropertyType>
+constexpr DiGraph::size_type DijkstraAlgorithm<ModifiablePropertyType>::NONE;
+
+template <template<typename T> class ModifiablePropertyType>
+void DijkstraAlgorithm<ModifiablePropertyType>::run()
+{
+    resetSlots();
+    slotOf.resetAll();
+    heap.clear();
+    dispatchDiGraph(diGraph, [this](auto *graph) { search(graph); });
+    storeResults();
+}
+
+template <template<typename T> class ModifiablePropertyType>
+template <typename GraphType>
+void DijkstraAlgorithm<ModifiablePropertyType>::search(GraphType *graph)
+{
+    Vertex *s = const_cast<Vertex*>(source);
+    slotOf[s] = addSlot(s, 0U, nullptr);
+    heap.reserveKeys(1U);
+    heap.push(0U, 0U);
+
+    while (!heap.empty()) {
+        auto slot = heap.top();
+        heap.pop();
+        if (settle(slot)) {
+            return;
+        }
+        auto d = slotDistance[slot];
+        graph->forEachOutgoing(slotVertex[slot], [&](Arc *a) {
+            Vertex *head = a->getHead();
+            weight_type nd = d + weightOf(a);
+            auto &headSlot = slotOf[head];
+            if (headSlot == NONE) {
+                headSlot = addSlot(head, nd, a);
+                heap.reserveKeys(slotVertex.size());
+                heap.push(headSlot, nd);
+            } else if (!slotSettled[headSlot] && nd < slotDistance[headSlot]) {
+                slotDistance[headSlot] = nd;
+                slotPredecessor[headSlot] = a;
+                heap.decrease(headSlot, nd);
+            }
+        });
+    }
+}
+
+template class DijkstraAlgorithm<PropertyMap>;
+template class DijkstraAlgorithm<FastPropertyMap>;
+
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef DIJKSTRAALGORITHM_H
+#define DIJKSTRAALGORITHM_H
+
+#include "shortestpathalgorithm.h"
+#include "datastructure/addressabledaryheap.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "property/traversalpropertymap.h"
+
+namespace Algora {
+
+/**
+ * Dijkstra's algorithm with an addressable 4-ary heap.
+ */
+template <template<typename T> class ModifiablePropertyType = PropertyMap>
+class DijkstraAlgorithm : public ShortestPathAlgorithm
+{
+public:
+    explicit DijkstraAlgorithm(bool computeValues = true)
+        : ShortestPathAlgorithm(computeValues), slotOf(NONE) { }
+    virtual ~DijkstraAlgorithm() override = default;
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Dijkstra"; }
+    virtual std::string getShortName() const noexcept override { return "dijkstra"; }
+
+private:
+    static constexpr DiGraph::size_type NONE = std::numeric_limits<DiGraph::size_type>::max();
+
+    typename TraversalPropertyMap<ModifiablePropertyType, DiGraph::size_type>::type slotOf;
+    AddressableDAryHeap<weight_type, 4U> heap;
+
+    template<typename GraphType>
+    void search(GraphType *graph);
+};
+
+extern template class DijkstraAlgorithm<PropertyMap>;
+extern template class DijkstraAlgorithm<FastPropertyMap>;
+
+}
+
+#endif // DIJKSTRAALGORITHM_H
@@ -0,0 +1,75 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "shortestpathalgorithm.h"
+
+#include "graph/vertex.h"
+#include "property/modifiableproperty.h"
+
+namespace Algora {
+
+constexpr ShortestPathAlgorithm::weight_type ShortestPathAlgorithm::INF;
+
+ShortestPathAlgorithm::ShortestPathAlgorithm(bool computeValues)
+    : PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>(computeValues),
+      source(nullptr), target(nullptr), weights(nullptr), predecessors(nullptr),
+      targetDistance(INF), numSettled(0U)
+{
+
+}
+
+bool ShortestPathAlgorithm::prepare()
+{
+    return PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>::prepare()
+            && source != nullptr && diGraph->containsVertex(source)
+            && (target == nullptr || diGraph->containsVertex(target));
+}
+
+DiGraph::size_type ShortestPathAlgorithm::deliver()
+{
+    return target ? targetDistance : numSettled;
+}
+
+void ShortestPathAlgorithm::resetSlots()
+{
+    slotVertex.clear();
+    slotDistance.clear();
+    slotPredecessor.clear();
+    slotSettled.clear();
+    targetDistance = INF;
+    numSettled = 0U;
+}
+
+void ShortestPathAlgorithm::storeResults()
+{
+    for (DiGraph::size_type i = 0U; i < slotVertex.size(); i++) {
+        bool settled = slotSettled[i];
+        if (computePropertyValues) {
+            property->setValue(slotVertex[i], settled ? slotDistance[i] : INF);
+        }
+        if (predecessors) {
+            predecessors->setValue(slotVertex[i], settled ? slotPredecessor[i] : nullptr);
+        }
+    }
+}
+
+}
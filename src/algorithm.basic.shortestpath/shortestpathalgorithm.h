@@ -0,0 +1,125 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef SHORTESTPATHALGORITHM_H
+#define SHORTESTPATHALGORITHM_H
+
+#include "algorithm/propertycomputingalgorithm.h"
+#include "graph/digraph.h"
+#include "graph/arc.h"
+#include "property/property.h"
+
+#include <limits>
+#include <vector>
+
+namespace Algora {
+
+class Vertex;
+
+/**
+ * Base class of single-source shortest path algorithms on nonnegative
+ * integral arc weights.
+ * By default, the weight of an arc is its size, i.e., the weight of a
+ * WeightedArc and the size of a MultiArc, and 1 for all other arcs;
+ * setArcWeights() overrides this.
+ * Computed values are distances from the source, INF for vertices that
+ * have been discovered but not settled.
+ * Only vertices discovered by a run are written, so a run costs time
+ * proportional to the explored part of the graph. Vertices not discovered
+ * keep their previous values; to read INF for them, reset the distance
+ * and predecessor properties with INF and nullptr as default values
+ * before each run, e.g., by EpochFastPropertyMap::resetAll() in constant time.
+ * If a target is set, the search stops as soon as the target is settled,
+ * and deliver() returns its distance; otherwise, deliver() returns the
+ * number of vertices settled, i.e., reachable from the source.
+ */
+class ShortestPathAlgorithm
+        : public PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>
+{
+public:
+    typedef DiGraph::size_type weight_type;
+    static constexpr weight_type INF = std::numeric_limits<weight_type>::max();
+
+    explicit ShortestPathAlgorithm(bool computeValues = true);
+    virtual ~ShortestPathAlgorithm() override = default;
+
+    void setSource(const Vertex *s) { source = s; }
+    // nullptr searches all vertices reachable from the source
+    void setTarget(const Vertex *t) { target = t; }
+    // nullptr reverts to arc sizes
+    void setArcWeights(const Property<weight_type> *w) { weights = w; }
+    // receives the last arc of a shortest path to each settled vertex
+    void usePredecessorProperty(ModifiableProperty<Arc*> *p) { predecessors = p; }
+
+    DiGraph::size_type getNumVerticesSettled() const { return numSettled; }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual bool prepare() override;
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual DiGraph::size_type deliver() override;
+
+protected:
+    const Vertex *source;
+    const Vertex *target;
+    const Property<weight_type> *weights;
+    ModifiableProperty<Arc*> *predecessors;
+
+    weight_type targetDistance;
+    DiGraph::size_type numSettled;
+
+    // vertices are numbered in the order of their discovery
+    std::vector<Vertex*> slotVertex;
+    std::vector<weight_type> slotDistance;
+    std::vector<Arc*> slotPredecessor;
+    std::vector<bool> slotSettled;
+
+    weight_type weightOf(const Arc *a) const {
+        return weights ? (*weights)(a) : a->getSize();
+    }
+
+    void resetSlots();
+    DiGraph::size_type addSlot(Vertex *v, weight_type distance, Arc *predecessor) {
+        slotVertex.push_back(v);
+        slotDistance.push_back(distance);
+        slotPredecessor.push_back(predecessor);
+        slotSettled.push_back(false);
+        return slotVertex.size() - 1U;
+    }
+    // marks the slot as settled; returns true if the search may stop
+    bool settle(DiGraph::size_type slot) {
+        slotSettled[slot] = true;
+        numSettled++;
+        if (slotVertex[slot] == target) {
+            targetDistance = slotDistance[slot];
+            return true;
+        }
+        return false;
+    }
+    void storeResults();
+};
+
+}
+
+#endif // SHORTESTPATHALGORITHM_H
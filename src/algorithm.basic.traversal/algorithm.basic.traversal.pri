@@ -25,6 +25,9 @@ message("pri file being processed: $$PWD")
 HEADERS += \ 
     $$PWD/graphtraversal.h \
     $$PWD/breadthfirstsearch.h \
-    $$PWD/depthfirstsearch.h
+    $$PWD/depthfirstsearch.h \
+    $$PWD/parallelbreadthfirstsearch.h \
+    $$PWD/multisourcebfs.h
 
-SOURCES +=      
+SOURCES += \
+    $$PWD/multisourcebfs.cpp
@@ -27,6 +27,8 @@
 #include "graph/digraph.h"
 #include "graph/graph_functional.h"
 #include "property/propertymap.h"
+#include "property/traversalpropertymap.h"
+#include "algorithm/digraphdispatch.h"
 
 #include <boost/circular_buffer.hpp>
 #include <limits>
@@ -49,9 +51,13 @@ public:
               valueComputation && computeValues),
           computeOrder(computeOrder), maxBfsNumber(INF), maxLevel(INF),
           treeArc(arcNothing), nonTreeArc(arcNothing),
-          stopAfterEachNeighborsScan(false)
+          customTreeArc(false), customNonTreeArc(false),
+          stopAfterEachNeighborsScan(false),
+          directionOptimizing(false), topDownFactor(14.0), bottomUpFactor(24.0),
+          bottomUpEnabled(false), frontierArcs(0ULL), unexploredArcs(0ULL)
     {
         discovered.setDefaultValue(false);
+        inFrontier.setDefaultValue(false);
     }
 
     virtual ~BreadthFirstSearch() { }
@@ -68,12 +74,29 @@ public:
         stopAfterEachNeighborsScan = stop;
     }
 
+    // Switch to bottom-up steps when the frontier becomes large, i.e., let
+    // undiscovered vertices search for a parent in the frontier.
+    // Only used if no per-arc callbacks except for tree arcs and no stop
+    // conditions are set, and levels instead of BFS numbers are computed.
+    void useDirectionOptimization(bool use) {
+        directionOptimizing = use;
+    }
+
+    // Go bottom-up if arcs(frontier) > arcs(unexplored) / topDown,
+    // return to top-down if |frontier| < |V| / bottomUp.
+    void setDirectionOptimizationFactors(double topDown, double bottomUp) {
+        topDownFactor = topDown;
+        bottomUpFactor = bottomUp;
+    }
+
     void onTreeArcDiscover(const ArcMapping &aFun) {
         treeArc = aFun;
+        customTreeArc = true;
     }
 
     void onNonTreeArcDiscover(const ArcMapping &aFun) {
         nonTreeArc = aFun;
+        customNonTreeArc = true;
     }
 
     DiGraph::size_type getMaxBfsNumber() const {
@@ -137,10 +160,24 @@ public:
         discovered.resetAll();
         exhausted = false;
 
+        bottomUpEnabled = directionOptimizing
+                && !this->customOnArcDiscovered && !this->customArcStopCondition
+                && !this->customVertexStopCondition && !customNonTreeArc
+                && !stopAfterEachNeighborsScan
+                && !(valueComputation && this->computePropertyValues && computeOrder);
+        if (bottomUpEnabled) {
+            frontierArcs = 0ULL;
+            unexploredArcs = this->diGraph->getNumArcs(true);
+            if (ignoreArcDirection) {
+                unexploredArcs *= 2;
+            }
+        }
+
         if (startVertices.empty()) {
             if (!this->onVertexDiscovered(this->startVertex)) {
                 return;
             }
+            trackDiscovery(this->startVertex, true);
             queue.push_back(this->startVertex);
             queue.push_back(nullptr);
             discovered.setValue(this->startVertex, true);
@@ -152,6 +189,7 @@ public:
                 if (!this->onVertexDiscovered(v)) {
                     continue;
                 }
+                trackDiscovery(v, true);
                 queue.push_back(v);
                 discovered.setValue(v, true);
                 if (valueComputation && this->computePropertyValues) {
@@ -170,6 +208,152 @@ public:
     }
 
     virtual void resume()
+    {
+        dispatchDiGraph(this->diGraph, [this](auto *graph) { resumeOn(graph); });
+    }
+
+    virtual std::string getName() const noexcept override { return "BFS"; }
+    virtual std::string getShortName() const noexcept override { return "bfs"; }
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual DiGraph::size_type deliver() override
+    {
+        return maxBfsNumber == INF ? INF : maxBfsNumber + 1ULL;
+    }
+
+private:
+    bool computeOrder;
+    DiGraph::size_type maxBfsNumber;
+    DiGraph::size_type maxLevel;
+
+    ArcMapping treeArc;
+    ArcMapping nonTreeArc;
+    bool customTreeArc;
+    bool customNonTreeArc;
+
+    // DiGraphAlgorithm interface
+private:
+    virtual void onDiGraphSet() override
+    {
+        maxBfsNumber = INF;
+        maxLevel = INF;
+    }
+    typename TraversalPropertyMap<ModifiablePropertyType, bool>::type discovered;
+    boost::circular_buffer<const Vertex*> queue;
+    std::vector<const Vertex*> startVertices;
+    bool exhausted;
+    bool stopAfterEachNeighborsScan;
+
+    bool directionOptimizing;
+    double topDownFactor;
+    double bottomUpFactor;
+    bool bottomUpEnabled;
+    DiGraph::size_type frontierArcs;
+    DiGraph::size_type unexploredArcs;
+    typename TraversalPropertyMap<ModifiablePropertyType, bool>::type inFrontier;
+    std::vector<const Vertex*> frontier;
+    std::vector<const Vertex*> nextFrontier;
+
+    DiGraph::size_type scanDegree(const Vertex *v) const
+    {
+        if (ignoreArcDirection) {
+            return this->diGraph->getOutDegree(v, true) + this->diGraph->getInDegree(v, true);
+        }
+        return reverseArcDirection ? this->diGraph->getInDegree(v, true)
+                                   : this->diGraph->getOutDegree(v, true);
+    }
+
+    void trackDiscovery(const Vertex *v, bool enqueued)
+    {
+        if (!bottomUpEnabled) {
+            return;
+        }
+        auto d = scanDegree(v);
+        unexploredArcs = d < unexploredArcs ? unexploredArcs - d : 0ULL;
+        if (enqueued) {
+            frontierArcs += d;
+        }
+    }
+
+    // Expects the queue to contain exactly the current frontier.
+    // On return, the queue contains either nothing or the frontier for the
+    // next top-down step, followed by a level separator.
+    template<typename GraphType>
+    void bottomUp(GraphType *graph)
+    {
+        auto getTail = [](const Arc *a, const Vertex *) { return a->getTail(); };
+        auto getHead = [](const Arc *a, const Vertex *) { return a->getHead(); };
+        auto getOtherEndVertex = [](const Arc *a, const Vertex *v) {
+            auto t = a->getTail(); return v == t ? a->getHead() : t;
+        };
+        const auto &getParent = ignoreArcDirection ? getOtherEndVertex
+                                                  : (reverseArcDirection ? getHead : getTail);
+        auto n = this->diGraph->getSize();
+
+        frontier.assign(queue.begin(), queue.end());
+        queue.clear();
+        frontierArcs = 0ULL;
+
+        while (!frontier.empty()) {
+            inFrontier.resetAll();
+            for (auto *v : frontier) {
+                inFrontier.setValue(v, true);
+            }
+            nextFrontier.clear();
+
+            graph->mapVertices([this,graph,&getParent](Vertex *v) {
+                if (this->discovered(v)) {
+                    return;
+                }
+                auto arcMapping = [this,v,&getParent](Arc *a) {
+                    if (!this->inFrontier(getParent(a, v))) {
+                        return true;
+                    }
+                    this->maxBfsNumber++;
+                    if (valueComputation && this->computePropertyValues) {
+                        this->property->setValue(v, this->maxLevel + 1);
+                    }
+                    this->discovered.setValue(v, true);
+                    if (this->customTreeArc) {
+                        this->treeArc(a);
+                    }
+                    bool expand = this->onVertexDiscovered(v);
+                    this->trackDiscovery(v, false);
+                    if (expand) {
+                        this->nextFrontier.push_back(v);
+                    }
+                    return false;
+                };
+                if (ignoreArcDirection) {
+                    if (graph->forEachIncoming(v, arcMapping)) {
+                        graph->forEachOutgoing(v, arcMapping);
+                    }
+                } else if (reverseArcDirection) {
+                    graph->forEachOutgoing(v, arcMapping);
+                } else {
+                    graph->forEachIncoming(v, arcMapping);
+                }
+            });
+
+            if (nextFrontier.empty()) {
+                return;
+            }
+            this->maxLevel++;
+            frontier.swap(nextFrontier);
+
+            if (frontier.size() * bottomUpFactor < n) {
+                for (auto *v : frontier) {
+                    queue.push_back(v);
+                }
+                queue.push_back(nullptr);
+                return;
+            }
+        }
+    }
+
+    template<typename GraphType>
+    void resumeOn(GraphType *graph)
     {
         auto getTail = [](const Arc *a, const Vertex *) { return a->getTail(); };
         auto getHead = [](const Arc *a, const Vertex *) { return a->getHead(); };
@@ -192,20 +376,27 @@ public:
             } else {
                 this->queue.pop_front();
                 if (!this->queue.empty()) {
-                    this->queue.push_back(nullptr);
                     this->maxLevel++;
+                    if (this->bottomUpEnabled
+                            && this->frontierArcs * this->topDownFactor > this->unexploredArcs) {
+                        this->bottomUp(graph);
+                    } else {
+                        this->frontierArcs = 0ULL;
+                        this->queue.push_back(nullptr);
+                    }
                 }
                 continue;
             }
 
             auto arcMapping = [this,curr,&stop,&getPeer](Arc *a) {
-                bool consider = this->onArcDiscovered(a);
-                if (!consider) {
-                    return;
+                if (this->customOnArcDiscovered && !this->onArcDiscovered(a)) {
+                    return true;
                 }
-                stop |= this->arcStopCondition(a);
-                if (stop) {
-                    return;
+                if (this->customArcStopCondition) {
+                    stop |= this->arcStopCondition(a);
+                    if (stop) {
+                        return false;
+                    }
                 }
                 Vertex *peer = getPeer(a, curr);
                 if (!this->discovered(peer)) {
@@ -216,25 +407,30 @@ public:
                         this->property->setValue(peer, v);
                     }
                     this->discovered.setValue(peer, true);
-                    this->treeArc(a);
+                    if (this->customTreeArc) {
+                        this->treeArc(a);
+                    }
                     if (!this->onVertexDiscovered(peer)) {
-                        return;
+                        this->trackDiscovery(peer, false);
+                        return true;
                     }
 
+                    this->trackDiscovery(peer, true);
                     this->queue.push_back(peer);
-                } else {
+                } else if (this->customNonTreeArc) {
                     this->nonTreeArc(a);
                 }
+                return true;
             };
-            auto arcStopCondition = [&stop](const Arc *) { return stop; };
 
             if (ignoreArcDirection) {
-                this->diGraph->mapOutgoingArcsUntil(curr, arcMapping, arcStopCondition);
-                this->diGraph->mapIncomingArcsUntil(curr, arcMapping, arcStopCondition);
+                if (graph->forEachOutgoing(curr, arcMapping)) {
+                    graph->forEachIncoming(curr, arcMapping);
+                }
             } else if (reverseArcDirection) {
-                this->diGraph->mapIncomingArcsUntil(curr, arcMapping, arcStopCondition);
+                graph->forEachIncoming(curr, arcMapping);
             } else {
-                this->diGraph->mapOutgoingArcsUntil(curr, arcMapping, arcStopCondition);
+                graph->forEachOutgoing(curr, arcMapping);
             }
 
             if (stopAfterEachNeighborsScan) {
@@ -248,36 +444,6 @@ public:
             this->exhausted = true;
         }
     }
-    virtual std::string getName() const noexcept override { return "BFS"; }
-    virtual std::string getShortName() const noexcept override { return "bfs"; }
-
-    // ValueComputingAlgorithm interface
-public:
-    virtual DiGraph::size_type deliver() override
-    {
-        return maxBfsNumber == INF ? INF : maxBfsNumber + 1ULL;
-    }
-
-private:
-    bool computeOrder;
-    DiGraph::size_type maxBfsNumber;
-    DiGraph::size_type maxLevel;
-
-    ArcMapping treeArc;
-    ArcMapping nonTreeArc;
-
-    // DiGraphAlgorithm interface
-private:
-    virtual void onDiGraphSet() override
-    {
-        maxBfsNumber = INF;
-        maxLevel = INF;
-    }
-    ModifiablePropertyType<bool> discovered;
-    boost::circular_buffer<const Vertex*> queue;
-    std::vector<const Vertex*> startVertices;
-    bool exhausted;
-    bool stopAfterEachNeighborsScan;
 };
 
 }
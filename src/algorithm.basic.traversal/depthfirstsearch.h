@@ -37,8 +37,12 @@
 #include "graphtraversal.h"
 #include "graph/digraph.h"
 #include "property/propertymap.h"
+#include "property/traversalpropertymap.h"
 #include "graph/graph_functional.h"
+#include "algorithm/digraphdispatch.h"
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 namespace Algora {
 
@@ -92,9 +96,8 @@ public:
                 this->startVertex != nullptr ? this->startVertex : this->diGraph->getAnyVertex();
 
 				DiGraph::size_type nextDepth = 0;
-        bool stop = false;
         discovered.resetAll();
-        dfs(source, nextDepth, stop);
+        dispatchDiGraph(this->diGraph, [&](auto *graph) { dfs(graph, source, nextDepth); });
         verticesReached = nextDepth;
     }
 
@@ -116,73 +119,111 @@ private:
     DiGraph::size_type verticesReached;
     ArcMapping treeArc;
     ArcMapping nonTreeArc;
-    ModifiablePropertyType<bool> discovered;
-
-    void dfs(const Vertex *v, DiGraph::size_type &depth, bool &stop) {
-        discovered[v] = true;
-        DFSResult *cur = nullptr;
+    typename TraversalPropertyMap<ModifiablePropertyType, bool>::type discovered;
+
+    // Arcs still to be considered, topmost first. An entry without arc
+    // marks the point at which vertex has been finished.
+    struct StackEntry {
+        Arc *arc;
+        const Vertex *vertex;
+        const Vertex *peer;
+    };
+    std::vector<StackEntry> stack;
+
+    // Numbers v and pushes its arcs such that they are considered in
+    // the same order as by a recursive DFS; returns false on stop.
+    template<typename GraphType>
+    bool visit(GraphType *graph, const Vertex *v, const Vertex *parent, DiGraph::size_type &depth)
+    {
+        discovered.setValue(v, true);
         if (this->computePropertyValues) {
-            cur = &(*this->property)[v];
-            cur->dfsNumber = depth;
-            cur->lowNumber = depth;
+            DFSResult &cur = (*this->property)[v];
+            cur.dfsNumber = depth;
+            cur.lowNumber = depth;
+            PRINT_DEBUG(v << " : low = " << cur.lowNumber);
         }
         depth++;
-        PRINT_DEBUG(v << " : low = " << cur->lowNumber);
 
+        stack.push_back(StackEntry{ nullptr, v, parent });
         if (!this->onVertexDiscovered(v)) {
-            return;
+            return true;
         }
 
-        stop |= this->vertexStopCondition(v);
+        if (this->vertexStopCondition(v)) {
+            return false;
+        }
 
-        if (stop) {
+        auto first = stack.size();
+        if (ignoreArcDirection || !reverseArcDirection) {
+            graph->forEachOutgoing(v, [this,v](Arc *a) {
+                stack.push_back(StackEntry{ a, v, a->getHead() });
+            });
+        }
+        if (ignoreArcDirection || reverseArcDirection) {
+            graph->forEachIncoming(v, [this,v](Arc *a) {
+                stack.push_back(StackEntry{ a, v, a->getTail() });
+            });
+        }
+        std::reverse(stack.begin() + first, stack.end());
+        return true;
+    }
+
+    template<typename GraphType>
+    void dfs(GraphType *graph, const Vertex *source, DiGraph::size_type &depth) {
+        stack.clear();
+        if (!visit(graph, source, nullptr, depth)) {
             return;
         }
 
-        auto vm = [&](const Vertex *v, const Vertex *u, Arc *arc) {
-            PRINT_DEBUG("Considering child " << u << " of " << v);
+        while (!stack.empty()) {
+            StackEntry e = stack.back();
+            stack.pop_back();
+            const Vertex *v = e.vertex;
+
+            if (!e.arc) {
+                // v is finished, e.peer is its parent
+                if (this->computePropertyValues && e.peer) {
+                    auto low = (*this->property)[v].lowNumber;
+                    DFSResult &parent = (*this->property)[e.peer];
+                    if (low < parent.lowNumber) {
+                        PRINT_DEBUG("Updating low from " << parent.lowNumber << " to " << low);
+                        parent.lowNumber = low;
+                    }
+                }
+                continue;
+            }
 
-            bool consider = this->onArcDiscovered(arc);
-            stop |= this->arcStopCondition(arc);
+            const Vertex *u = e.peer;
+            PRINT_DEBUG("Considering child " << u << " of " << v);
 
-            if (stop || !consider) {
+            bool consider = this->onArcDiscovered(e.arc);
+            if (this->arcStopCondition(e.arc)) {
                 return;
             }
+            if (!consider) {
+                continue;
+            }
 
-            if (!discovered[u]) {
+            if (!discovered(u)) {
                 if (this->computePropertyValues) {
                     (*this->property)[u].parent = v;
                 }
-                PRINT_DEBUG("Set parent of " << u << " to " << (*property)[u].parent);
-                treeArc(arc);
-
-                dfs(u, depth, stop);
-
-                if (stop) {
+                PRINT_DEBUG("Set parent of " << u << " to " << v);
+                treeArc(e.arc);
+                if (!visit(graph, u, v, depth)) {
                     return;
                 }
-
+            } else {
+                nonTreeArc(e.arc);
                 if (this->computePropertyValues) {
-                    if ((*this->property)[u].lowNumber < cur->lowNumber) {
-                        PRINT_DEBUG("Updating low from " << cur->lowNumber << " to " << (*property)[u].lowNumber);
-                        cur->lowNumber = (*this->property)[u].lowNumber;
-                        PRINT_DEBUG("Low is now " << (*property)[v].lowNumber)
+                    auto dfsNumber = (*this->property)[u].dfsNumber;
+                    DFSResult &cur = (*this->property)[v];
+                    if (cur.parent != u && dfsNumber < cur.lowNumber) {
+                        PRINT_DEBUG("Updating low from " << cur.lowNumber << " to " << dfsNumber);
+                        cur.lowNumber = dfsNumber;
                     }
                 }
-            } else {
-                nonTreeArc(arc);
-                if (this->computePropertyValues && cur->parent != u && (*this->property)[u].dfsNumber < cur->lowNumber) {
-                    PRINT_DEBUG("Updating low from " << cur->lowNumber << " to " << (*property)[u].dfsNumber);
-                    cur->lowNumber = (*this->property)[u].dfsNumber;
-                    PRINT_DEBUG("Low is now " << (*property)[v].lowNumber);
-                }
             }
-        };
-        if (!stop && (ignoreArcDirection || !reverseArcDirection)) {
-            this->diGraph->mapOutgoingArcsUntil(v, [&](Arc *a) { vm(v, a->getHead(), a); }, [&stop](const Arc *) { return stop; });
-        }
-        if (!stop && (ignoreArcDirection || reverseArcDirection)) {
-            this->diGraph->mapIncomingArcsUntil(v, [&](Arc *a) { vm(v, a->getTail(), a); }, [&stop](const Arc *) { return stop; });
         }
     }
 };
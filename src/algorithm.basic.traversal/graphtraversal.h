@@ -38,7 +38,10 @@ public:
         : PropertyComputingAlgorithm<DiGraph::size_type, PropertyType>(computeValues),
           startVertex(nullptr),
           onVertexDiscovered(vertexTrue), onArcDiscovered(arcTrue),
-          vertexStopCondition(vertexFalse), arcStopCondition(arcFalse)
+          vertexStopCondition(vertexFalse), arcStopCondition(arcFalse),
+          customOnVertexDiscovered(false),
+          customOnArcDiscovered(false), customArcStopCondition(false),
+          customVertexStopCondition(false)
     { }
 
     virtual ~GraphTraversal() { }
@@ -49,18 +52,22 @@ public:
 
     void onVertexDiscover(const VertexPredicate &vFun) {
         onVertexDiscovered = vFun;
+        customOnVertexDiscovered = true;
     }
 
     void onArcDiscover(const ArcPredicate &aFun) {
         onArcDiscovered = aFun;
+        customOnArcDiscovered = true;
     }
 
     void setVertexStopCondition(const VertexPredicate &vStop) {
         vertexStopCondition = vStop;
+        customVertexStopCondition = true;
     }
 
     void setArcStopCondition(const ArcPredicate &aStop) {
         arcStopCondition = aStop;
+        customArcStopCondition = true;
     }
 
     virtual DiGraph::size_type numVerticesReached() const = 0;
@@ -82,6 +89,12 @@ protected:
     ArcPredicate onArcDiscovered;
     VertexPredicate vertexStopCondition;
     ArcPredicate arcStopCondition;
+
+    // allow per-arc calls to be skipped when no custom callbacks are set
+    bool customOnVertexDiscovered;
+    bool customOnArcDiscovered;
+    bool customArcStopCondition;
+    bool customVertexStopCondition;
 };
 
 }
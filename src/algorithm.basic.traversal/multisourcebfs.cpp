@@ -0,0 +1,141 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "multisourcebfs.h"
+
+#include "graph.static/staticdigraph.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Algora {
+
+namespace {
+
+template<unsigned W, typename M>
+inline bool isZero(const M &m) {
+    std::uint64_t any = 0U;
+    for (unsigned i = 0U; i < W; i++) {
+        any |= m.w[i];
+    }
+    return any == 0U;
+}
+
+}
+
+MultiSourceBFS::MultiSourceBFS(const StaticDiGraph *graph, bool reverseArcDirection)
+    : graph(graph), reverseArcDirection(reverseArcDirection), numSources(0U),
+      maxLevel(MAX_SOURCES, 0U), reachedByAll(Mask())
+{
+
+}
+
+void MultiSourceBFS::setGraph(const StaticDiGraph *graph)
+{
+    this->graph = graph;
+    numSources = 0U;
+}
+
+void MultiSourceBFS::run(const std::vector<size_type> &sources)
+{
+    if (sources.size() > MAX_SOURCES) {
+        throw std::invalid_argument("Too many sources for a multi-source BFS.");
+    }
+    run(sources.data(), static_cast<unsigned>(sources.size()));
+}
+
+void MultiSourceBFS::run(const size_type *sources, unsigned count)
+{
+    if (count > MAX_SOURCES) {
+        throw std::invalid_argument("Too many sources for a multi-source BFS.");
+    }
+    size_type n = graph->getSize();
+    numSources = count;
+    std::fill(maxLevel.begin(), maxLevel.end(), 0U);
+
+    const Mask zero = Mask();
+    seen.assign(n, zero);
+    visit.assign(n, zero);
+    visitNext.assign(n, zero);
+
+    for (unsigned s = 0U; s < count; s++) {
+        if (sources[s] >= n) {
+            throw std::invalid_argument("Source index must be less than graph size.");
+        }
+        Mask &m = seen[sources[s]];
+        m.w[s >> 6] |= std::uint64_t(1U) << (s & 63U);
+        visit[sources[s]] = m;
+    }
+
+    bool active = count > 0U;
+    for (size_type level = 1U; active; level++) {
+        Mask reached = zero;
+        for (size_type v = 0U; v < n; v++) {
+            const Mask &mv = visit[v];
+            if (isZero<WORDS>(mv)) {
+                continue;
+            }
+            size_type begin = reverseArcDirection ? graph->inBegin(v) : graph->outBegin(v);
+            size_type end = reverseArcDirection ? graph->inEnd(v) : graph->outEnd(v);
+            for (size_type k = begin; k < end; k++) {
+                size_type u = reverseArcDirection ? graph->tailIndexAt(k) : graph->headIndexAt(k);
+                Mask &next = visitNext[u];
+                const Mask &su = seen[u];
+                for (unsigned i = 0U; i < WORDS; i++) {
+                    next.w[i] |= mv.w[i] & ~su.w[i];
+                }
+            }
+        }
+
+        active = false;
+        for (size_type u = 0U; u < n; u++) {
+            Mask &next = visitNext[u];
+            Mask &su = seen[u];
+            for (unsigned i = 0U; i < WORDS; i++) {
+                su.w[i] |= next.w[i];
+                reached.w[i] |= next.w[i];
+            }
+            visit[u] = next;
+            next = zero;
+        }
+
+        for (unsigned i = 0U; i < WORDS; i++) {
+            std::uint64_t bits = reached.w[i];
+            active |= bits != 0U;
+            while (bits) {
+                maxLevel[i * 64U + static_cast<unsigned>(__builtin_ctzll(bits))] = level;
+                bits &= bits - 1U;
+            }
+        }
+    }
+
+    for (unsigned i = 0U; i < WORDS; i++) {
+        reachedByAll.w[i] = ~std::uint64_t(0U);
+    }
+    for (size_type u = 0U; u < n; u++) {
+        for (unsigned i = 0U; i < WORDS; i++) {
+            reachedByAll.w[i] &= seen[u].w[i];
+        }
+    }
+}
+
+}
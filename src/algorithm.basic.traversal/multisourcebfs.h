@@ -0,0 +1,84 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef MULTISOURCEBFS_H
+#define MULTISOURCEBFS_H
+
+#include "graph/digraph.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Algora {
+
+class StaticDiGraph;
+
+/**
+ * Bit-parallel breadth-first search from up to MAX_SOURCES sources at once
+ * (MS-BFS). Every vertex holds one bit per source in each of the masks
+ * seen, visit and visitNext, so a single scan of an arc advances all
+ * searches that currently visit its tail.
+ * Vertices and sources are given by their index in a StaticDiGraph.
+ */
+class MultiSourceBFS
+{
+public:
+    typedef DiGraph::size_type size_type;
+    static constexpr unsigned WORDS = 4U;
+    static constexpr unsigned MAX_SOURCES = 64U * WORDS;
+
+    explicit MultiSourceBFS(const StaticDiGraph *graph = nullptr, bool reverseArcDirection = false);
+
+    void setGraph(const StaticDiGraph *graph);
+    void setReverseArcDirection(bool reverse) { reverseArcDirection = reverse; }
+
+    // Runs a BFS from sources[0], ..., sources[count - 1] with count <= MAX_SOURCES.
+    void run(const size_type *sources, unsigned count);
+    void run(const std::vector<size_type> &sources);
+
+    unsigned getNumSources() const { return numSources; }
+    // level of the farthest vertex reached from the i-th source
+    size_type getMaxLevel(unsigned i) const { return maxLevel[i]; }
+    // whether the i-th source reached every vertex
+    bool reachedAll(unsigned i) const {
+        return (reachedByAll.w[i >> 6] >> (i & 63U)) & 1U;
+    }
+
+private:
+    struct alignas(32) Mask {
+        std::uint64_t w[WORDS];
+    };
+
+    const StaticDiGraph *graph;
+    bool reverseArcDirection;
+    unsigned numSources;
+
+    std::vector<Mask> seen;
+    std::vector<Mask> visit;
+    std::vector<Mask> visitNext;
+    std::vector<size_type> maxLevel;
+    Mask reachedByAll;
+};
+
+}
+
+#endif // MULTISOURCEBFS_H
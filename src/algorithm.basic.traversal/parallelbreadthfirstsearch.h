@@ -0,0 +1,350 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef PARALLELBREADTHFIRSTSEARCH_H
+#define PARALLELBREADTHFIRSTSEARCH_H
+
+#include "graphtraversal.h"
+#include "graph/digraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "graph.static/staticdigraph.h"
+#include "algorithm/digraphdispatch.h"
+#include "parallel/threadpool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Algora {
+
+/**
+ * Level-synchronous breadth-first search that expands each frontier on a thread pool.
+ * Vertices are claimed by an atomic test-and-set on a discovered bitset and collected
+ * in thread-local buffers, which are concatenated in thread order after each level.
+ * BFS numbers therefore respect levels, but ties within a level may be broken
+ * differently than by BreadthFirstSearch.
+ *
+ * Requires a graph with vertex indices (IncidenceListGraph or StaticDiGraph).
+ * Arc callbacks and stop conditions are not supported; onVertexDiscover() is
+ * called sequentially when a level is merged.
+ */
+template <bool reverseArcDirection = false, bool ignoreArcDirection = false>
+class ParallelBreadthFirstSearch : public GraphTraversal<DiGraph::size_type,
+        reverseArcDirection, ignoreArcDirection>
+{
+public:
+    static constexpr DiGraph::size_type INF = std::numeric_limits<DiGraph::size_type>::max();
+
+    explicit ParallelBreadthFirstSearch(bool computeValues = true, bool computeOrder = true)
+        : GraphTraversal<DiGraph::size_type,reverseArcDirection, ignoreArcDirection>(computeValues),
+          computeOrder(computeOrder), maxBfsNumber(INF), maxLevel(INF),
+          numThreads(0U), pool(nullptr), sequentialThreshold(1024U), numWords(0U)
+    { }
+
+    virtual ~ParallelBreadthFirstSearch() { }
+
+    // 0 uses all hardware threads
+    void setNumThreads(unsigned n) {
+        numThreads = n;
+        ownPool.reset();
+    }
+
+    // use an external pool instead of an own one; nullptr reverts to an own pool
+    void useThreadPool(ThreadPool *threadPool) {
+        pool = threadPool;
+    }
+
+    // frontiers with fewer vertices are expanded by the calling thread only
+    void setSequentialThreshold(DiGraph::size_type threshold) {
+        sequentialThreshold = threshold;
+    }
+
+    void setStartVertices(const std::vector<const Vertex*> &startVertices) {
+        this->startVertices = startVertices;
+    }
+
+    DiGraph::size_type getMaxBfsNumber() const {
+        return maxBfsNumber;
+    }
+
+    DiGraph::size_type getMaxLevel() const {
+        return maxLevel;
+    }
+
+    void orderAsValues(bool order) {
+        computeOrder = order;
+    }
+
+    void levelAsValues(bool levels) {
+        computeOrder = !levels;
+    }
+
+    bool vertexDiscovered(const Vertex *v) const {
+        auto i = dispatchIndex(v);
+        return i < numWords * 64U && (discovered[i >> 6].load(std::memory_order_relaxed) & bit(i));
+    }
+
+    // GraphTraversal interface
+    DiGraph::size_type numVerticesReached() const override {
+        return maxBfsNumber == INF ? 0ULL : maxBfsNumber + 1;
+    }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual bool prepare() override
+    {
+        return GraphTraversal<DiGraph::size_type, reverseArcDirection, ignoreArcDirection>::prepare()
+                && hasCompactVertexIds(this->diGraph)
+                && !this->customOnArcDiscovered && !this->customArcStopCondition
+                && !this->customVertexStopCondition
+                && std::all_of(startVertices.begin(), startVertices.end(),
+                               [this](const Vertex *v){
+                    return this->diGraph->containsVertex(v) && v->isValid(); });
+    }
+
+    virtual void run() override
+    {
+        if (this->startVertex == nullptr && startVertices.empty()) {
+            this->startVertex = this->diGraph->getAnyVertex();
+        }
+        if (auto *ilGraph = dynamic_cast<IncidenceListGraph*>(this->diGraph)) {
+            search(ilGraph);
+        } else {
+            search(dynamic_cast<StaticDiGraph*>(this->diGraph));
+        }
+    }
+
+    virtual std::string getName() const noexcept override { return "Parallel BFS"; }
+    virtual std::string getShortName() const noexcept override { return "par-bfs"; }
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual DiGraph::size_type deliver() override
+    {
+        return maxBfsNumber == INF ? INF : maxBfsNumber + 1ULL;
+    }
+
+    // DiGraphAlgorithm interface
+private:
+    virtual void onDiGraphSet() override
+    {
+        maxBfsNumber = INF;
+        maxLevel = INF;
+    }
+
+private:
+    typedef std::uint64_t word_type;
+
+    struct alignas(64) LocalFrontier {
+        std::vector<const Vertex*> vertices;
+    };
+
+    bool computeOrder;
+    DiGraph::size_type maxBfsNumber;
+    DiGraph::size_type maxLevel;
+
+    unsigned numThreads;
+    ThreadPool *pool;
+    std::unique_ptr<ThreadPool> ownPool;
+    DiGraph::size_type sequentialThreshold;
+
+    std::vector<const Vertex*> startVertices;
+    std::unique_ptr<std::atomic<word_type>[]> discovered;
+    DiGraph::size_type numWords;
+    std::vector<const Vertex*> frontier;
+    std::vector<const Vertex*> nextFrontier;
+    std::vector<LocalFrontier> localFrontiers;
+    std::vector<DiGraph::size_type> offsets;
+
+    static word_type bit(DiGraph::size_type i) {
+        return word_type(1U) << (i & 63U);
+    }
+
+    DiGraph::size_type dispatchIndex(const Vertex *v) const {
+        if (auto *ilGraph = dynamic_cast<const IncidenceListGraph*>(this->diGraph)) {
+            return vertexIndexOf(ilGraph, v);
+        }
+        return vertexIndexOf(static_cast<const StaticDiGraph*>(nullptr), v);
+    }
+
+    bool tryDiscover(DiGraph::size_type i) {
+        auto &word = discovered[i >> 6];
+        auto mask = bit(i);
+        if (word.load(std::memory_order_relaxed) & mask) {
+            return false;
+        }
+        return !(word.fetch_or(mask, std::memory_order_relaxed) & mask);
+    }
+
+    ThreadPool &threadPool() {
+        if (pool) {
+            return *pool;
+        }
+        if (!ownPool) {
+            ownPool.reset(new ThreadPool(numThreads));
+        }
+        return *ownPool;
+    }
+
+    void setValue(const Vertex *v, DiGraph::size_type level) {
+        if (this->computePropertyValues) {
+            this->property->setValue(v, computeOrder ? maxBfsNumber : level);
+        }
+    }
+
+    template<typename GraphType>
+    void search(GraphType *graph)
+    {
+        ThreadPool &tp = threadPool();
+        auto n = graph->getSize();
+
+        auto words = (n + 63U) >> 6;
+        if (words != numWords) {
+            discovered.reset(new std::atomic<word_type>[words]);
+            numWords = words;
+        }
+        if (words < sequentialThreshold) {
+            for (DiGraph::size_type i = 0U; i < words; i++) {
+                discovered[i].store(0U, std::memory_order_relaxed);
+            }
+        } else {
+            tp.parallelFor(0U, words, [this](DiGraph::size_type i) {
+                discovered[i].store(0U, std::memory_order_relaxed);
+            });
+        }
+        localFrontiers.resize(tp.getNumThreads());
+        offsets.resize(tp.getNumThreads() + 1U);
+        frontier.clear();
+
+        maxBfsNumber = 0ULL;
+        maxLevel = 0ULL;
+
+        if (startVertices.empty()) {
+            if (!this->onVertexDiscovered(this->startVertex)) {
+                return;
+            }
+            tryDiscover(vertexIndexOf(graph, this->startVertex));
+            frontier.push_back(this->startVertex);
+            setValue(this->startVertex, 0U);
+        } else {
+            for (auto *v : startVertices) {
+                if (!this->onVertexDiscovered(v) || !tryDiscover(vertexIndexOf(graph, v))) {
+                    continue;
+                }
+                frontier.push_back(v);
+                setValue(v, 0U);
+                maxBfsNumber++;
+            }
+            if (frontier.empty()) {
+                return;
+            }
+            maxBfsNumber--;
+        }
+
+        auto getTail = [](const Arc *a, const Vertex *) { return a->getTail(); };
+        auto getHead = [](const Arc *a, const Vertex *) { return a->getHead(); };
+        auto getOtherEndVertex = [](const Arc *a, const Vertex *v) {
+            auto t = a->getTail(); return v == t ? a->getHead() : t;
+        };
+        const auto &getPeer = ignoreArcDirection ? getOtherEndVertex
+                                                : (reverseArcDirection ? getTail : getHead);
+
+        auto expand = [this,graph,&getPeer](unsigned t, DiGraph::size_type begin,
+                DiGraph::size_type end) {
+            auto &local = localFrontiers[t].vertices;
+            local.clear();
+            for (auto i = begin; i < end; i++) {
+                const Vertex *curr = frontier[i];
+                auto arcMapping = [this,graph,curr,&local,&getPeer](Arc *a) {
+                    const Vertex *peer = getPeer(a, curr);
+                    if (tryDiscover(vertexIndexOf(graph, peer))) {
+                        local.push_back(peer);
+                    }
+                };
+                if (ignoreArcDirection) {
+                    graph->forEachOutgoing(curr, arcMapping);
+                    graph->forEachIncoming(curr, arcMapping);
+                } else if (reverseArcDirection) {
+                    graph->forEachIncoming(curr, arcMapping);
+                } else {
+                    graph->forEachOutgoing(curr, arcMapping);
+                }
+            }
+        };
+
+        while (!frontier.empty()) {
+            auto size = frontier.size();
+            unsigned threads = size < sequentialThreshold ? 1U : tp.getNumThreads();
+            if (threads == 1U) {
+                expand(0U, 0U, size);
+            } else {
+                tp.run([this,&tp,&expand,size](unsigned t) {
+                    expand(t, tp.chunkBegin(0U, size, t), tp.chunkBegin(0U, size, t + 1U));
+                });
+            }
+
+            nextFrontier.clear();
+            if (this->computePropertyValues || this->customOnVertexDiscovered) {
+                for (unsigned t = 0U; t < threads; t++) {
+                    for (auto *v : localFrontiers[t].vertices) {
+                        maxBfsNumber++;
+                        setValue(v, maxLevel + 1U);
+                        if (this->onVertexDiscovered(v)) {
+                            nextFrontier.push_back(v);
+                        }
+                    }
+                }
+            } else {
+                offsets[0] = 0U;
+                for (unsigned t = 0U; t < threads; t++) {
+                    offsets[t + 1] = offsets[t] + localFrontiers[t].vertices.size();
+                }
+                nextFrontier.resize(offsets[threads]);
+                maxBfsNumber += offsets[threads];
+                auto copy = [this](unsigned t) {
+                    const auto &local = localFrontiers[t].vertices;
+                    std::copy(local.begin(), local.end(), nextFrontier.begin() + offsets[t]);
+                };
+                if (threads == 1U || offsets[threads] < sequentialThreshold) {
+                    for (unsigned t = 0U; t < threads; t++) {
+                        copy(t);
+                    }
+                } else {
+                    tp.run(copy);
+                }
+            }
+
+            if (nextFrontier.empty()) {
+                break;
+            }
+            maxLevel++;
+            frontier.swap(nextFrontier);
+        }
+    }
+};
+
+}
+
+#endif // PARALLELBREADTHFIRSTSEARCH_H
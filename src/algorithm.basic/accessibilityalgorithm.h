@@ -29,6 +29,10 @@ namespace Algora {
 
 class Vertex;
 
+/**
+ * Reachability queries backed by a ReachabilityIndex.
+ * The index is built by run(), or by the first query after the graph has been set.
+ */
 class AccessibilityAlgorithm : public PropertyComputingAlgorithm<void, bool>
 {
 public:
@@ -45,6 +49,7 @@ public:
 
 protected:
     virtual void onDiGraphSet() override;
+    virtual void onDiGraphUnset() override;
 
     // ValueComputingAlgorithm interface
 public:
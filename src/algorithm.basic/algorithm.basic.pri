@@ -30,7 +30,13 @@ HEADERS += \
     $$PWD/biconnectedcomponentsalgorithm.h \
     $$PWD/accessibilityalgorithm.h \
     $$PWD/eccentricityalgorithm.h \
-    $$PWD/radiusdiameteralgorithm.h
+    $$PWD/radiusdiameteralgorithm.h \
+    $$PWD/alleccentricitiesalgorithm.h \
+    $$PWD/parallelsccalgorithm.h \
+    $$PWD/reachabilityindex.h \
+    $$PWD/batchdipathalgorithm.h \
+    $$PWD/weaklyconnectedcomponentsalgorithm.h \
+    $$PWD/incrementalweaklyconnectedcomponentsalgorithm.h
 
 SOURCES += \
     $$PWD/finddipathalgorithm.cpp \
@@ -40,4 +46,10 @@ SOURCES += \
     $$PWD/biconnectedcomponentsalgorithm.cpp \
     $$PWD/accessibilityalgorithm.cpp \
     $$PWD/eccentricityalgorithm.cpp \
-    $$PWD/radiusdiameteralgorithm.cpp
+    $$PWD/radiusdiameteralgorithm.cpp \
+    $$PWD/alleccentricitiesalgorithm.cpp \
+    $$PWD/parallelsccalgorithm.cpp \
+    $$PWD/reachabilityindex.cpp \
+    $$PWD/batchdipathalgorithm.cpp \
+    $$PWD/weaklyconnectedcomponentsalgorithm.cpp \
+    $$PWD/incrementalweaklyconnectedcomponentsalgorithm.cpp
@@ -0,0 +1,89 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "alleccentricitiesalgorithm.h"
+
+#include "algorithm.basic.traversal/multisourcebfs.h"
+#include "graph.static/staticdigraph.h"
+#include "property/fastpropertymap.h"
+
+#include <climits>
+
+namespace Algora {
+
+const int AllEccentricitiesAlgorithm::INFINITE = INT_MAX;
+
+AllEccentricitiesAlgorithm::AllEccentricitiesAlgorithm(bool computeValues)
+    : PropertyComputingAlgorithm<int, int>(computeValues), radius(INFINITE), diameter(INFINITE)
+{
+
+}
+
+void AllEccentricitiesAlgorithm::run()
+{
+    radius = INT_MAX;
+    diameter = -1;
+
+    FastPropertyMap<GraphArtifact*> original(nullptr);
+    StaticDiGraph snapshot;
+    const StaticDiGraph *graph = dynamic_cast<StaticDiGraph*>(diGraph);
+    if (!graph) {
+        snapshot.assign(diGraph, nullptr, nullptr, &original);
+        graph = &snapshot;
+    }
+
+    MultiSourceBFS msBfs(graph);
+    std::vector<DiGraph::size_type> sources;
+    DiGraph::size_type n = graph->getSize();
+    for (DiGraph::size_type first = 0U; first < n; first += MultiSourceBFS::MAX_SOURCES) {
+        sources.clear();
+        for (DiGraph::size_type i = first; i < n && i < first + MultiSourceBFS::MAX_SOURCES; i++) {
+            sources.push_back(i);
+        }
+        msBfs.run(sources);
+
+        for (unsigned s = 0U; s < sources.size(); s++) {
+            int e = msBfs.reachedAll(s) ? static_cast<int>(msBfs.getMaxLevel(s)) : INFINITE;
+            if (e > diameter) {
+                diameter = e;
+            }
+            if (e < radius) {
+                radius = e;
+            }
+            if (computePropertyValues) {
+                Vertex *v = graph->vertexAt(sources[s]);
+                if (graph == &snapshot) {
+                    v = static_cast<Vertex*>(original(v));
+                }
+                property->setValue(v, e);
+            }
+        }
+    }
+}
+
+void AllEccentricitiesAlgorithm::onDiGraphSet()
+{
+    radius = INFINITE;
+    diameter = INFINITE;
+}
+
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef ALLECCENTRICITIESALGORITHM_H
+#define ALLECCENTRICITIESALGORITHM_H
+
+#include "algorithm/propertycomputingalgorithm.h"
+
+namespace Algora {
+
+/**
+ * Computes the eccentricity of every vertex by multi-source BFS runs
+ * over a static snapshot of the graph.
+ * Delivers the maximum eccentricity, i.e., the diameter.
+ */
+class AllEccentricitiesAlgorithm : public PropertyComputingAlgorithm<int, int>
+{
+public:
+    static const int INFINITE;
+
+    explicit AllEccentricitiesAlgorithm(bool computeValues = true);
+    virtual ~AllEccentricitiesAlgorithm() override { }
+
+    int getRadius() const { return radius; }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "All Eccentricities Algorithm"; }
+    virtual std::string getShortName() const noexcept override { return "all-ecc"; }
+
+protected:
+    virtual void onDiGraphSet() override;
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual int deliver() override { return diameter; }
+
+private:
+    int radius;
+    int diameter;
+};
+
+}
+
+#endif // ALLECCENTRICITIESALGORITHM_H
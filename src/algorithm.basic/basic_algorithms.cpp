@@ -24,17 +24,65 @@
 
 #include "graph/digraph.h"
 #include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "algorithm/digraphdispatch.h"
 
 #include "algorithm.basic.traversal/breadthfirstsearch.h"
 #include "algorithm.basic.traversal/depthfirstsearch.h"
 #include "tarjansccalgorithm.h"
+#include "parallelsccalgorithm.h"
+#include "weaklyconnectedcomponentsalgorithm.h"
 #include "topsortalgorithm.h"
 #include "biconnectedcomponentsalgorithm.h"
 #include "eccentricityalgorithm.h"
 #include "radiusdiameteralgorithm.h"
+#include "alleccentricitiesalgorithm.h"
+
+#include <thread>
 
 namespace Algora {
 
+namespace {
+
+// if the numbering need not be topological, graphs of at least this size
+// are decomposed by ParallelSCCAlgorithm if more than one hardware thread is available
+const DiGraph::size_type PARALLEL_SCC_THRESHOLD = 1U << 16;
+
+// with topological = true, components are numbered in topological order
+DiGraph::size_type computeSccs(DiGraph *diGraph, ModifiableProperty<DiGraph::size_type> &sccOf,
+                               bool topological)
+{
+    if (!topological && diGraph->getSize() >= PARALLEL_SCC_THRESHOLD
+            && std::thread::hardware_concurrency() > 1U) {
+        ParallelSCCAlgorithm scc;
+        scc.useModifiableProperty(&sccOf);
+        return runAlgorithm(scc, diGraph);
+    }
+    if (hasCompactVertexIds(diGraph)) {
+        TarjanSCCAlgorithm<FastPropertyMap> tarjan;
+        tarjan.useModifiableProperty(&sccOf);
+        return runAlgorithm(tarjan, diGraph);
+    }
+    TarjanSCCAlgorithm<> tarjan;
+    tarjan.useModifiableProperty(&sccOf);
+    return runAlgorithm(tarjan, diGraph);
+}
+
+template<template<typename T> class PropertyType>
+bool reachesAll(DiGraph *diGraph, Vertex *source)
+{
+    BreadthFirstSearch<PropertyType, false> forward(false);
+    forward.setStartVertex(source);
+    if (runAlgorithm(forward, diGraph) != diGraph->getSize()) {
+        return false;
+    }
+    BreadthFirstSearch<PropertyType, false, true> backward(false);
+    backward.setStartVertex(source);
+    return runAlgorithm(backward, diGraph) == diGraph->getSize();
+}
+
+}
+
 bool hasDiPath(DiGraph *diGraph, Vertex *from, Vertex *to) {
     FindDiPathAlgorithm<> findDiPath(false, false, true);
     return runDiPathAlgorithm(diGraph, from, to, findDiPath);
@@ -48,15 +96,34 @@ bool isAcyclic(DiGraph *diGraph) {
 
 bool isStronglyConnected(DiGraph *diGraph)
 {
-    return countStrongComponents(diGraph) == 1;
+    if (diGraph->isEmpty()) {
+        return false;
+    }
+    if (hasCompactVertexIds(diGraph)) {
+        return reachesAll<FastPropertyMap>(diGraph, diGraph->getAnyVertex());
+    }
+    return reachesAll<PropertyMap>(diGraph, diGraph->getAnyVertex());
 }
 
 DiGraph::size_type countStrongComponents(DiGraph *diGraph)
 {
-    TarjanSCCAlgorithm<> tarjan;
+    if (hasCompactVertexIds(diGraph)) {
+        FastPropertyMap<DiGraph::size_type> sccs(0);
+        return computeSccs(diGraph, sccs, false);
+    }
     PropertyMap<DiGraph::size_type> sccs(0);
-    tarjan.useModifiableProperty(&sccs);
-    return runAlgorithm(tarjan, diGraph);
+    return computeSccs(diGraph, sccs, false);
+}
+
+bool isWeaklyConnected(DiGraph *diGraph)
+{
+    return countWeakComponents(diGraph) == 1;
+}
+
+DiGraph::size_type countWeakComponents(DiGraph *diGraph)
+{
+    WeaklyConnectedComponentsAlgorithm wcc(false);
+    return runAlgorithm(wcc, diGraph);
 }
 
 bool isBiconnected(DiGraph *diGraph)
@@ -87,6 +154,13 @@ int computeEccentricity(DiGraph *diGraph, const Vertex *v)
     return runAlgorithm(ecc, diGraph);
 }
 
+void computeEccentricities(DiGraph *diGraph, ModifiableProperty<int> &eccentricities)
+{
+    AllEccentricitiesAlgorithm ecc;
+    ecc.useModifiableProperty(&eccentricities);
+    runAlgorithm(ecc, diGraph);
+}
+
 int computeRadius(DiGraph *diGraph)
 {
     RadiusDiameterAlgorithm rd;
@@ -105,10 +179,8 @@ int computeDiameter(DiGraph *diGraph)
 
 void computeCondensation(DiGraph *diGraph, DiGraph *condensedGraph)
 {
-    TarjanSCCAlgorithm<> tarjan;
     PropertyMap<DiGraph::size_type> sccOf(0);
-    tarjan.useModifiableProperty(&sccOf);
-    auto sccs = runAlgorithm(tarjan, diGraph);
+    auto sccs = computeSccs(diGraph, sccOf, true);
     condensedGraph->clear();
     std::vector<Vertex*> sccVertices;
     for (auto i = 0UL; i < sccs; i++) {
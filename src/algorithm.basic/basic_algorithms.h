@@ -30,6 +30,9 @@ namespace Algora {
 class DiGraph;
 class Vertex;
 
+template<typename T>
+class ModifiableProperty;
+
 bool hasDiPath(DiGraph *diGraph, Vertex *from, Vertex *to);
 
 bool runDiPathAlgorithm(DiGraph *diGraph, Vertex *from, Vertex *to, FindDiPathAlgorithm<> &a);
@@ -40,12 +43,18 @@ bool isStronglyConnected(DiGraph *diGraph);
 
 DiGraph::size_type countStrongComponents(DiGraph *diGraph);
 
+bool isWeaklyConnected(DiGraph *diGraph);
+
+DiGraph::size_type countWeakComponents(DiGraph *diGraph);
+
 bool isBiconnected(DiGraph *diGraph);
 
 int countBiconnectedComponents(DiGraph *diGraph);
 
 int computeEccentricity(DiGraph *diGraph, const Vertex *v);
 
+void computeEccentricities(DiGraph *diGraph, ModifiableProperty<int> &eccentricities);
+
 int computeRadius(DiGraph *diGraph);
 
 int computeDiameter(DiGraph *diGraph);
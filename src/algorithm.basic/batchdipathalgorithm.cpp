@@ -0,0 +1,280 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "batchdipathalgorithm.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "graph.static/staticdigraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "algorithm/digraphdispatch.h"
+#include "parallel/threadpool.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Algora {
+
+namespace {
+
+typedef DiGraph::size_type size_type;
+
+const size_type NONE = std::numeric_limits<size_type>::max();
+
+}
+
+constexpr DiGraph::size_type BatchDiPathAlgorithm::UNREACHABLE;
+
+struct BatchDiPathAlgorithm::Workspace {
+    // a vertex is visited (resp. a target) in the current group iff its stamp equals epoch
+    std::vector<unsigned> visited;
+    std::vector<unsigned> wanted;
+    unsigned epoch = 0U;
+    std::vector<size_type> distance;
+    std::vector<Arc*> parent;
+    // first query of the current group with the vertex as target
+    std::vector<size_type> firstQuery;
+    std::vector<size_type> queue;
+
+    void nextEpoch(size_type n, bool withParents) {
+        if (visited.size() != n) {
+            visited.assign(n, 0U);
+            wanted.assign(n, 0U);
+            distance.resize(n);
+            firstQuery.resize(n);
+            epoch = 0U;
+        }
+        if (withParents && parent.size() != n) {
+            parent.resize(n);
+        }
+        if (++epoch == 0U) {
+            std::fill(visited.begin(), visited.end(), 0U);
+            std::fill(wanted.begin(), wanted.end(), 0U);
+            epoch = 1U;
+        }
+    }
+};
+
+BatchDiPathAlgorithm::BatchDiPathAlgorithm(bool constructArcPaths)
+    : ValueComputingAlgorithm<DiGraph::size_type>(), constructArcPaths(constructArcPaths),
+      numPaths(0U), numThreads(0U), pool(nullptr)
+{
+
+}
+
+BatchDiPathAlgorithm::~BatchDiPathAlgorithm()
+{
+
+}
+
+void BatchDiPathAlgorithm::setNumThreads(unsigned n)
+{
+    numThreads = n;
+    ownPool.reset();
+}
+
+bool BatchDiPathAlgorithm::prepare()
+{
+    if (!ValueComputingAlgorithm<DiGraph::size_type>::prepare()) {
+        return false;
+    }
+    for (const auto &q : queries) {
+        if (!diGraph->containsVertex(q.first) || !diGraph->containsVertex(q.second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void BatchDiPathAlgorithm::run()
+{
+    distances.assign(queries.size(), UNREACHABLE);
+    arcPaths.clear();
+    if (constructArcPaths) {
+        arcPaths.resize(queries.size());
+    }
+    numPaths = 0U;
+    if (queries.empty()) {
+        return;
+    }
+
+    std::vector<size_type> sources(queries.size());
+    std::vector<size_type> targets(queries.size());
+    auto direct = [&](auto *graph) {
+        for (size_type i = 0U; i < queries.size(); i++) {
+            sources[i] = vertexIndexOf(graph, queries[i].first);
+            targets[i] = vertexIndexOf(graph, queries[i].second);
+        }
+        answer(graph, sources, targets, [](Arc *a) { return a; });
+    };
+    if (auto *ilGraph = dynamic_cast<IncidenceListGraph*>(diGraph)) {
+        direct(ilGraph);
+    } else if (auto *staticGraph = dynamic_cast<StaticDiGraph*>(diGraph)) {
+        direct(staticGraph);
+    } else {
+        PropertyMap<GraphArtifact*> otherToThis(nullptr);
+        FastPropertyMap<GraphArtifact*> thisToOtherArcs(nullptr);
+        StaticDiGraph snapshot;
+        snapshot.assign(diGraph, &otherToThis, nullptr, nullptr,
+                        constructArcPaths ? &thisToOtherArcs : nullptr);
+        for (size_type i = 0U; i < queries.size(); i++) {
+            sources[i] = vertexIndexOf(&snapshot, static_cast<Vertex*>(otherToThis(queries[i].first)));
+            targets[i] = vertexIndexOf(&snapshot, static_cast<Vertex*>(otherToThis(queries[i].second)));
+        }
+        answer(&snapshot, sources, targets, [&thisToOtherArcs](Arc *a) {
+            return static_cast<Arc*>(thisToOtherArcs(a));
+        });
+    }
+
+    for (auto d : distances) {
+        if (d != UNREACHABLE) {
+            numPaths++;
+        }
+    }
+}
+
+void BatchDiPathAlgorithm::onDiGraphUnset()
+{
+    workspaces.clear();
+    ValueComputingAlgorithm<DiGraph::size_type>::onDiGraphUnset();
+}
+
+ThreadPool &BatchDiPathAlgorithm::threadPool()
+{
+    if (pool) {
+        return *pool;
+    }
+    if (!ownPool) {
+        ownPool.reset(new ThreadPool(numThreads));
+    }
+    return *ownPool;
+}
+
+template<typename GraphType, typename ArcMap>
+void BatchDiPathAlgorithm::answer(GraphType *graph, const std::vector<DiGraph::size_type> &sources,
+                                  const std::vector<DiGraph::size_type> &targets, const ArcMap &arcMap)
+{
+    size_type n = graph->getSize();
+    std::vector<size_type> order(queries.size());
+    for (size_type i = 0U; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&sources](size_type a, size_type b) {
+        return sources[a] < sources[b];
+    });
+    // groupBegin[g] is the position in order of the first query of group g
+    std::vector<size_type> groupBegin;
+    for (size_type i = 0U; i < order.size(); i++) {
+        if (i == 0U || sources[order[i]] != sources[order[i - 1]]) {
+            groupBegin.push_back(i);
+        }
+    }
+    groupBegin.push_back(order.size());
+    size_type numGroups = groupBegin.size() - 1U;
+    // next query of the same group with the same target
+    std::vector<size_type> nextQuery(queries.size(), NONE);
+
+    auto answerGroup = [&](Workspace &ws, size_type g) {
+        ws.nextEpoch(n, constructArcPaths);
+        auto s = sources[order[groupBegin[g]]];
+        size_type remaining = 0U;
+        for (auto k = groupBegin[g]; k < groupBegin[g + 1]; k++) {
+            auto q = order[k];
+            auto t = targets[q];
+            if (t == s) {
+                distances[q] = 0U;
+            } else if (ws.wanted[t] != ws.epoch) {
+                ws.wanted[t] = ws.epoch;
+                ws.firstQuery[t] = q;
+                remaining++;
+            } else {
+                nextQuery[q] = ws.firstQuery[t];
+                ws.firstQuery[t] = q;
+            }
+        }
+        if (remaining == 0U) {
+            return;
+        }
+        ws.queue.clear();
+        ws.queue.push_back(s);
+        ws.visited[s] = ws.epoch;
+        ws.distance[s] = 0U;
+        for (size_type i = 0U; i < ws.queue.size() && remaining > 0U; i++) {
+            auto v = ws.queue[i];
+            graph->forEachOutgoing(graph->vertexAt(v), [&](Arc *a) {
+                auto w = vertexIndexOf(graph, a->getHead());
+                if (ws.visited[w] == ws.epoch) {
+                    return true;
+                }
+                ws.visited[w] = ws.epoch;
+                ws.distance[w] = ws.distance[v] + 1U;
+                if (constructArcPaths) {
+                    ws.parent[w] = a;
+                }
+                if (ws.wanted[w] == ws.epoch) {
+                    for (auto q = ws.firstQuery[w]; q != NONE; q = nextQuery[q]) {
+                        distances[q] = ws.distance[w];
+                        if (constructArcPaths) {
+                            auto &path = arcPaths[q];
+                            path.reserve(ws.distance[w]);
+                            for (auto u = w; u != s; u = vertexIndexOf(graph, ws.parent[u]->getTail())) {
+                                path.push_back(arcMap(ws.parent[u]));
+                            }
+                            std::reverse(path.begin(), path.end());
+                        }
+                    }
+                    if (--remaining == 0U) {
+                        return false;
+                    }
+                }
+                ws.queue.push_back(w);
+                return true;
+            });
+        }
+    };
+
+    unsigned numWorkers = numGroups > 1U
+            ? static_cast<unsigned>(std::min<size_type>(threadPool().getNumThreads(), numGroups))
+            : 1U;
+    while (workspaces.size() < numWorkers) {
+        workspaces.emplace_back(new Workspace);
+    }
+    if (numWorkers == 1U) {
+        for (size_type g = 0U; g < numGroups; g++) {
+            answerGroup(*workspaces[0], g);
+        }
+        return;
+    }
+    std::atomic<size_type> nextGroup(0U);
+    threadPool().run([&](unsigned t) {
+        if (t >= numWorkers) {
+            return;
+        }
+        for (auto g = nextGroup.fetch_add(1U); g < numGroups; g = nextGroup.fetch_add(1U)) {
+            answerGroup(*workspaces[t], g);
+        }
+    });
+}
+
+}
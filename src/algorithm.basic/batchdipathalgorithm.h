@@ -0,0 +1,113 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BATCHDIPATHALGORITHM_H
+#define BATCHDIPATHALGORITHM_H
+
+#include "algorithm/valuecomputingalgorithm.h"
+#include "graph/digraph.h"
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Algora {
+
+class Vertex;
+class Arc;
+class ThreadPool;
+
+/**
+ * Answers a batch of (source, target) queries for directed paths with a
+ * minimum number of arcs.
+ * Queries are grouped by source, and each group is answered by a single BFS
+ * that stops as soon as all of its targets have been reached.
+ * Groups are distributed over threads; every thread keeps its traversal
+ * state across groups and runs and resets it in constant time.
+ * deliver() returns the number of queries for which a path exists.
+ */
+class BatchDiPathAlgorithm : public ValueComputingAlgorithm<DiGraph::size_type>
+{
+public:
+    typedef std::pair<const Vertex*, const Vertex*> Query;
+
+    static constexpr DiGraph::size_type UNREACHABLE = std::numeric_limits<DiGraph::size_type>::max();
+
+    explicit BatchDiPathAlgorithm(bool constructArcPaths = false);
+    virtual ~BatchDiPathAlgorithm() override;
+
+    void setConstructArcPaths(bool arcPaths) { constructArcPaths = arcPaths; }
+
+    void setQueries(const std::vector<Query> &q) { queries = q; }
+    void setQueries(std::vector<Query> &&q) { queries = std::move(q); }
+    void addQuery(const Vertex *source, const Vertex *target) { queries.emplace_back(source, target); }
+    void clearQueries() { queries.clear(); }
+    const std::vector<Query> &getQueries() const { return queries; }
+
+    // 0 uses all hardware threads
+    void setNumThreads(unsigned n);
+    // use an external pool instead of an own one; nullptr reverts to an own pool
+    void useThreadPool(ThreadPool *threadPool) { pool = threadPool; }
+
+    // results, by position of the query
+    bool hasDiPath(DiGraph::size_type i) const { return distances[i] != UNREACHABLE; }
+    DiGraph::size_type getDistance(DiGraph::size_type i) const { return distances[i]; }
+    const std::vector<Arc*> &getArcsOnPath(DiGraph::size_type i) const { return arcPaths[i]; }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual bool prepare() override;
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Batch FindDiPath"; }
+    virtual std::string getShortName() const noexcept override { return "batch-dipath"; }
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual DiGraph::size_type deliver() override { return numPaths; }
+
+protected:
+    virtual void onDiGraphUnset() override;
+
+private:
+    struct Workspace;
+
+    bool constructArcPaths;
+    std::vector<Query> queries;
+    std::vector<DiGraph::size_type> distances;
+    std::vector<std::vector<Arc*>> arcPaths;
+    DiGraph::size_type numPaths;
+
+    unsigned numThreads;
+    ThreadPool *pool;
+    std::unique_ptr<ThreadPool> ownPool;
+    std::vector<std::unique_ptr<Workspace>> workspaces;
+
+    ThreadPool &threadPool();
+    template<typename GraphType, typename ArcMap>
+    void answer(GraphType *graph, const std::vector<DiGraph::size_type> &sources,
+                const std::vector<DiGraph::size_type> &targets, const ArcMap &arcMap);
+};
+
+}
+
+#endif // BATCHDIPATHALGORITHM_H
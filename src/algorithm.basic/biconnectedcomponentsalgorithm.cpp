@@ -26,6 +26,8 @@
 #include "graph/digraph.h"
 #include "property/propertymap.h"
 
+#include <algorithm>
+
 //#define DEBUG_BIC
 
 #ifdef DEBUG_BIC
@@ -39,7 +41,7 @@
 
 namespace Algora {
 
-int findBiconnectedComponents(std::vector<Vertex *> &dfsOrderRev,
+int findBiconnectedComponents(std::vector<const Vertex *> &dfsOrderRev,
                               PropertyMap<DFSResult> &dfs, ModifiableProperty<std::vector<int> > &bics);
 
 BiconnectedComponentsAlgorithm::BiconnectedComponentsAlgorithm()
@@ -59,19 +61,21 @@ void BiconnectedComponentsAlgorithm::run()
     DepthFirstSearch<PropertyMap, false, true> dfs;
     dfs.useModifiableProperty(&dfsResult);
 
-    auto n = diGraph->getSize();
-    std::vector<Vertex*> dfsOrderRev(n, nullptr);
-    int verticesReached = 0;
+    // DFS numbers restart with every run, so record the global order instead
+    std::vector<const Vertex*> dfsOrderRev;
+    dfsOrderRev.reserve(diGraph->getSize());
+    dfs.onVertexDiscover([&dfsOrderRev](const Vertex *v) {
+        dfsOrderRev.push_back(v);
+        return true;
+    });
     diGraph->mapVertices([&](Vertex *v) {
-        auto dfsNum = dfsResult(v).dfsNumber;
-        if (dfsNum == -1) {
+        if (dfsResult(v).dfsNumber == -1) {
             PRINT_DEBUG("Running DFS starting from " << v);
             dfs.setStartVertex(v);
-            verticesReached += runAlgorithm(dfs, diGraph);
+            runAlgorithm(dfs, diGraph);
         }
-        dfsNum = dfsResult(v).dfsNumber;
-        dfsOrderRev[verticesReached - 1 - dfsNum] = v;
     });
+    std::reverse(dfsOrderRev.begin(), dfsOrderRev.end());
     numBics = findBiconnectedComponents(dfsOrderRev, dfsResult, *property);
 }
 
@@ -80,13 +84,13 @@ int BiconnectedComponentsAlgorithm::deliver()
     return numBics;
 }
 
-int findBiconnectedComponents(std::vector<Vertex*> &dfsOrderRev,
+int findBiconnectedComponents(std::vector<const Vertex*> &dfsOrderRev,
                               PropertyMap<DFSResult> &dfs, ModifiableProperty<std::vector<int> > &bics) {
     // cut(v) <=> (v, u) in DfsTree : lowNumber(u) >= dfsNumber(v), if v not root
     //            v has > 1 child in DfsTree, if v is root
     int curBic = 0;
 
-    for (Vertex *u : dfsOrderRev) {
+    for (const Vertex *u : dfsOrderRev) {
         PRINT_DEBUG("Considering vertex " << u << " with number "
                     << dfs(u).dfsNumber  << ", low " << dfs(u).lowNumber  << ", parent " << dfs(u).parent);
         const Vertex *v = dfs(u).parent;
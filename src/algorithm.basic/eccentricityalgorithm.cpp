@@ -24,7 +24,9 @@
 #include "algorithm.basic.traversal/breadthfirstsearch.h"
 
 #include "graph/digraph.h"
+#include "property/fastpropertymap.h"
 #include "algorithm/digraphalgorithmexception.h"
+#include "algorithm/digraphdispatch.h"
 
 #include <climits>
 
@@ -32,12 +34,52 @@ namespace Algora {
 
 const int EccentricityAlgorithm::INFINITE = INT_MAX;
 
+// BFS instances are kept across runs so that their state is reset, not reallocated
+class EccentricityAlgorithm::CheshireCat {
+public:
+    BreadthFirstSearch<PropertyMap, false> bfs;
+    BreadthFirstSearch<FastPropertyMap, false> fastBfs;
+    bool useFastBfs;
+
+    CheshireCat() : bfs(false), fastBfs(false), useFastBfs(false) {
+        bfs.orderAsValues(false);
+        fastBfs.orderAsValues(false);
+        useDirectionOptimization(true);
+    }
+
+    void useDirectionOptimization(bool use) {
+        bfs.useDirectionOptimization(use);
+        fastBfs.useDirectionOptimization(use);
+    }
+
+    template<typename BFS>
+    int eccentricity(BFS &bfs, DiGraph *graph, const Vertex *v) {
+        bfs.setGraph(graph);
+        bfs.setStartVertex(v);
+        if (!bfs.prepare()) {
+            throw DiGraphAlgorithmException("Could not prepare BFS algorithm.");
+        }
+        bfs.run();
+        return bfs.deliver() == graph->getSize() ? static_cast<int>(bfs.getMaxLevel()) : INFINITE;
+    }
+};
+
 EccentricityAlgorithm::EccentricityAlgorithm()
-    : ValueComputingAlgorithm<int>(), vertex(nullptr), eccentricity(INFINITE)
+    : ValueComputingAlgorithm<int>(), vertex(nullptr), eccentricity(INFINITE), grin(new CheshireCat)
 {
 
 }
 
+EccentricityAlgorithm::~EccentricityAlgorithm()
+{
+    delete grin;
+}
+
+void EccentricityAlgorithm::useDirectionOptimization(bool use)
+{
+    grin->useDirectionOptimization(use);
+}
+
 bool EccentricityAlgorithm::prepare()
 {
     return ValueComputingAlgorithm<int>::prepare() && diGraph->containsVertex(vertex);
@@ -45,15 +87,21 @@ bool EccentricityAlgorithm::prepare()
 
 void EccentricityAlgorithm::run()
 {
-    BreadthFirstSearch<> bfs(false);
-    bfs.setStartVertex(vertex);
-    bfs.orderAsValues(false);
-    eccentricity = runAlgorithm(bfs, diGraph) == diGraph->getSize() ? bfs.getMaxLevel() :  INFINITE;
+    eccentricity = grin->useFastBfs ? grin->eccentricity(grin->fastBfs, diGraph, vertex)
+                                    : grin->eccentricity(grin->bfs, diGraph, vertex);
 }
 
 void EccentricityAlgorithm::onDiGraphSet() {
     ValueComputingAlgorithm<int>::onDiGraphSet();
     eccentricity = -1;
+    grin->useFastBfs = hasCompactVertexIds(diGraph);
+}
+
+void EccentricityAlgorithm::onDiGraphUnset()
+{
+    grin->bfs.unsetGraph();
+    grin->fastBfs.unsetGraph();
+    ValueComputingAlgorithm<int>::onDiGraphUnset();
 }
 
 }
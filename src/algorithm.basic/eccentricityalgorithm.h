@@ -35,9 +35,10 @@ public:
     static const int INFINITE;
 
     explicit EccentricityAlgorithm();
-    virtual ~EccentricityAlgorithm() {}
+    virtual ~EccentricityAlgorithm() override;
 
     void setVertex(const Vertex *v) { vertex = v; eccentricity = INFINITE; }
+    void useDirectionOptimization(bool use);
 
     // DiGraphAlgorithm interface
 public:
@@ -48,6 +49,7 @@ public:
 
 protected:
     virtual void onDiGraphSet() override;
+    virtual void onDiGraphUnset() override;
 
     // ValueComputingAlgorithm interface
 public:
@@ -56,6 +58,9 @@ public:
 private:
     const Vertex *vertex;
     int eccentricity;
+
+    class CheshireCat;
+    CheshireCat *grin;
 };
 
 }
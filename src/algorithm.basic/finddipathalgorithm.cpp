@@ -28,6 +28,7 @@
 #include "property/propertymap.h"
 #include "algorithm.basic.traversal/breadthfirstsearch.h"
 #include "algorithm/digraphalgorithmexception.h"
+#include "algorithm/digraphdispatch.h"
 
 #include "property/fastpropertymap.h"
 
@@ -76,13 +77,9 @@ void FindDiPathAlgorithm<property_map_type>::run()
     pathFound = false;
 
     if (twoWaySearch) {
-        if (constructVertexPath || constructArcPath) {
-            runTwoWayPathSearch();
-            if (constructVertexPath) {
-                constructVertexFromArcPath();
-            }
-        } else  {
-            runTwoWaySearch();
+        runTwoWaySearch();
+        if (constructVertexPath) {
+            constructVertexFromArcPath();
         }
     } else {
         if (constructVertexPath || constructArcPath) {
@@ -105,188 +102,104 @@ bool FindDiPathAlgorithm<property_map_type>::deliver()
 template<template <typename T> typename property_map_type>
 void FindDiPathAlgorithm<property_map_type>::runTwoWaySearch()
 {
-    BreadthFirstSearch<property_map_type,false> forwardBfs(false, false);
-    forwardBfs.setGraph(diGraph);
-    forwardBfs.setStartVertex(from);
-
-    BreadthFirstSearch<property_map_type,false,true,false> backwardBfs(false, false);
-    backwardBfs.setGraph(diGraph);
-    backwardBfs.setStartVertex(to);
-
-    bool reachable = false;
+    Arc *fbLink = dispatchDiGraph(diGraph, [this](auto *graph) {
+        return twoWaySearchLink(graph);
+    });
+    pathFound = fbLink != nullptr;
+    pr_num_vertices_seen += forwardSide.queue.size() + backwardSide.queue.size();
 
-    forwardBfs.setArcStopCondition([&backwardBfs,&reachable](const Arc *a) {
-        if (backwardBfs.vertexDiscovered(a->getHead())) {
-            reachable = true;
+    arcPath.clear();
+    if (fbLink && (constructVertexPath || constructArcPath)) {
+        auto v = fbLink->getTail();
+        while (v != from) {
+            auto *a = forwardSide.treeArc(v);
+            arcPath.push_back(a);
+            v = a->getTail();
         }
-        return reachable;
-    });
-    backwardBfs.setArcStopCondition([&forwardBfs,&reachable](const Arc *a) {
-        if (forwardBfs.vertexDiscovered(a->getTail())) {
-            reachable = true;
+        std::reverse(arcPath.begin(), arcPath.end());
+        arcPath.push_back(fbLink);
+        v = fbLink->getHead();
+        while (v != to) {
+            auto *a = backwardSide.treeArc(v);
+            arcPath.push_back(a);
+            v = a->getHead();
         }
-        return reachable;
-    });
-
-    if (twoWayStepSize > 0) {
-        auto forwardStop = twoWayStepSize;
-        auto backwardStop = twoWayStepSize;
-        auto stepSize = this->twoWayStepSize;
-        forwardBfs.setVertexStopCondition(
-                    [&forwardBfs,&forwardStop,&stepSize](const Vertex *) {
-            if (forwardBfs.getMaxBfsNumber() >= forwardStop) {
-                forwardStop += stepSize;
-                return true;
-            }
-            return false;
-        });
-
-        backwardBfs.setVertexStopCondition(
-                    [&backwardBfs,&backwardStop,&stepSize](const Vertex *) {
-            if (backwardBfs.getMaxBfsNumber() >= backwardStop) {
-                backwardStop += stepSize;
-                return true;
-            }
-            return false;
-        });
-    } else {
-        forwardBfs.autoStopAfterNeighborsScans(true);
-        backwardBfs.autoStopAfterNeighborsScans(true);
-    }
-
-    forwardBfs.prepare();
-    backwardBfs.prepare();
-
-    forwardBfs.run();
-    backwardBfs.run();
-
-    while (!reachable && !forwardBfs.isExhausted() && !backwardBfs.isExhausted()
-           && forwardBfs.getMaxLevel() + backwardBfs.getMaxLevel() < diGraph->getSize()) {
-        forwardBfs.resume();
-        backwardBfs.resume();
     }
-    pathFound = reachable;
-    pr_num_vertices_seen += forwardBfs.numVerticesReached() + backwardBfs.numVerticesReached();
 }
 
 template<template <typename T> typename property_map_type>
-void FindDiPathAlgorithm<property_map_type>::onDiGraphSet()
-{
-    vertexPath.clear();
-    arcPath.clear();
-    pathFound = false;
-}
-
-template<template <typename T> typename property_map_type>
-void FindDiPathAlgorithm<property_map_type>::runTwoWayPathSearch()
+template<typename GraphType>
+Arc *FindDiPathAlgorithm<property_map_type>::twoWaySearchLink(GraphType *graph)
 {
-    BreadthFirstSearch<property_map_type,true> forwardBfs(false, false);
-    forwardBfs.setGraph(diGraph);
-    forwardBfs.setStartVertex(from);
-
-    BreadthFirstSearch<property_map_type,true,true,false> backwardBfs(false, false);
-    backwardBfs.setGraph(diGraph);
-    backwardBfs.setStartVertex(to);
-
-    property_map_type<DiGraph::size_type> outBFSLevel(0);
-    property_map_type<DiGraph::size_type> inBFSLevel(0);
-    forwardBfs.useModifiableProperty(&outBFSLevel);
-    forwardBfs.levelAsValues(true);
-    backwardBfs.useModifiableProperty(&inBFSLevel);
-    backwardBfs.levelAsValues(true);
+    auto start = [](SearchSide &side, Vertex *v, DiGraph::size_type degree) {
+        side.visited.resetAll();
+        side.treeArc.resetAll();
+        side.queue.clear();
+        side.next = 0U;
+        side.visited.setValue(v, true);
+        side.queue.push_back(v);
+        side.pendingDegree = degree;
+    };
+    start(forwardSide, from, graph->getOutDegree(from, true));
+    start(backwardSide, to, graph->getInDegree(to, true));
 
-    property_map_type<Arc*> treeArc(nullptr);
     Arc *fbLink = nullptr;
-
-    forwardBfs.setArcStopCondition([fbLink](const Arc *) {
-        return fbLink != nullptr;
-    });
-    backwardBfs.setArcStopCondition([fbLink](const Arc *) {
-        return fbLink != nullptr;
-    });
-
-    if (twoWayStepSize > 0) {
-        auto forwardStop = twoWayStepSize;
-        auto backwardStop = twoWayStepSize;
-        auto stepSize = this->twoWayStepSize;
-        forwardBfs.setVertexStopCondition(
-                    [&forwardBfs,&forwardStop,&stepSize](const Vertex *) {
-            if (forwardBfs.getMaxBfsNumber() >= forwardStop) {
-                forwardStop+= stepSize;
+    // expands vertices of one side; returns false if a link has been found
+    auto expand = [&](bool forward) {
+        SearchSide &side = forward ? forwardSide : backwardSide;
+        SearchSide &other = forward ? backwardSide : forwardSide;
+        auto end = side.queue.size();
+        if (twoWayStepSize > 0 && side.next + twoWayStepSize < end) {
+            end = side.next + twoWayStepSize;
+        }
+        while (side.next < end) {
+            Vertex *v = side.queue[side.next++];
+            auto scan = [&](Arc *a) {
+                Vertex *w = forward ? a->getHead() : a->getTail();
+                if (side.visited(w)) {
+                    return true;
+                }
+                if (other.visited(w)) {
+                    fbLink = a;
+                    return false;
+                }
+                side.visited.setValue(w, true);
+                side.treeArc.setValue(w, a);
+                side.queue.push_back(w);
+                side.pendingDegree += forward ? graph->getOutDegree(w, true)
+                                              : graph->getInDegree(w, true);
                 return true;
+            };
+            if (forward) {
+                side.pendingDegree -= graph->getOutDegree(v, true);
+                graph->forEachOutgoing(v, scan);
+            } else {
+                side.pendingDegree -= graph->getInDegree(v, true);
+                graph->forEachIncoming(v, scan);
             }
-            return false;
-        });
-
-        backwardBfs.setVertexStopCondition(
-                    [&backwardBfs,&backwardStop,&stepSize](const Vertex *) {
-            if (backwardBfs.getMaxBfsNumber() >= backwardStop) {
-                backwardStop+= stepSize;
-                return true;
+            if (fbLink) {
+                return false;
             }
-            return false;
-        });
-    } else {
-        forwardBfs.autoStopAfterNeighborsScans(true);
-        backwardBfs.autoStopAfterNeighborsScans(true);
-    }
-
-    forwardBfs.onTreeArcDiscover([&backwardBfs,&treeArc,&fbLink](const Arc *a) {
-        if (fbLink) {
-            return;
         }
-        auto head = a->getHead();
-        if (backwardBfs.vertexDiscovered(head)) {
-            fbLink = const_cast<Arc*>(a);
-        } else {
-            treeArc[head] = const_cast<Arc*>(a);
-        }
-    });
-    backwardBfs.onTreeArcDiscover([&forwardBfs,&treeArc,&fbLink](const Arc *a) {
-        if (fbLink) {
-            return;
-        }
-        auto tail = a->getTail();
-        if (forwardBfs.vertexDiscovered(tail)) {
-            fbLink = const_cast<Arc*>(a);
-        } else {
-            treeArc[tail] = const_cast<Arc*>(a);
+        return true;
+    };
+
+    while (forwardSide.next < forwardSide.queue.size()
+           && backwardSide.next < backwardSide.queue.size()) {
+        bool forward = forwardSide.pendingDegree <= backwardSide.pendingDegree;
+        if (!expand(forward)) {
+            break;
         }
-    });
-
-    forwardBfs.prepare();
-    backwardBfs.prepare();
-
-    forwardBfs.run();
-    backwardBfs.run();
-
-    while (!fbLink && !forwardBfs.isExhausted() && !backwardBfs.isExhausted()
-           && forwardBfs.getMaxLevel() + backwardBfs.getMaxLevel() < diGraph->getSize()) {
-        forwardBfs.resume();
-        backwardBfs.resume();
     }
+    return fbLink;
+}
 
+template<template <typename T> typename property_map_type>
+void FindDiPathAlgorithm<property_map_type>::onDiGraphSet()
+{
+    vertexPath.clear();
     arcPath.clear();
-    if (fbLink) {
-        auto v = fbLink->getTail();
-        while (v != from) {
-            auto *a = treeArc(v);
-            arcPath.push_back(a);
-            v = a->getTail();
-        }
-        std::reverse(arcPath.begin(), arcPath.end());
-        arcPath.push_back(fbLink);
-        v = fbLink->getHead();
-        while (v != to) {
-            auto *a = treeArc(v);
-            arcPath.push_back(a);
-            v = a->getHead();
-        }
-
-        assert(!arcPath.empty());
-    }
-    pathFound = fbLink != nullptr;
-    pr_num_vertices_seen += forwardBfs.numVerticesReached() + backwardBfs.numVerticesReached();
+    pathFound = false;
 }
 
 template<template <typename T> typename property_map_type>
@@ -25,6 +25,7 @@
 
 #include "algorithm/valuecomputingalgorithm.h"
 #include "property/propertymap.h"
+#include "property/traversalpropertymap.h"
 #include "graph/digraph.h"
 
 #include <vector>
@@ -55,6 +56,9 @@ public:
         twoWaySearch = twoWay;
     }
 
+    // The two-way search always advances the side whose pending vertices have
+    // the smaller summed degree. With a step size of 0, that side expands a
+    // full BFS level, otherwise at most stepSize vertices.
     void setTwoWayStepSize(unsigned long stepSize) {
         twoWayStepSize = stepSize;
     }
@@ -130,7 +134,6 @@ private:
     Vertex *to;
     bool twoWaySearch;
     unsigned long twoWayStepSize;
-    bool fastPropertyMap;
 
     std::vector<Vertex*> vertexPath;
     std::vector<Arc*> arcPath;
@@ -138,10 +141,24 @@ private:
 
     DiGraph::size_type pr_num_vertices_seen;
 
+    // state of one direction of the two-way search, kept across runs
+    struct SearchSide {
+        typename TraversalPropertyMap<property_map_type, bool>::type visited;
+        typename TraversalPropertyMap<property_map_type, Arc*>::type treeArc;
+        std::vector<Vertex*> queue;
+        typename std::vector<Vertex*>::size_type next = 0U;
+        DiGraph::size_type pendingDegree = 0U;
+
+        SearchSide() : visited(false), treeArc(nullptr) { }
+    };
+    SearchSide forwardSide;
+    SearchSide backwardSide;
+
     void runOneWaySearch();
     void runOneWayPathSearch();
     void runTwoWaySearch();
-    void runTwoWayPathSearch();
+    template<typename GraphType>
+    Arc *twoWaySearchLink(GraphType *graph);
 
     void constructVertexFromArcPath();
 
@@ -0,0 +1,120 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "incrementalweaklyconnectedcomponentsalgorithm.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "algorithm/digraphdispatch.h"
+
+namespace Algora {
+
+IncrementalWeaklyConnectedComponentsAlgorithm::IncrementalWeaklyConnectedComponentsAlgorithm()
+    : DiGraphAlgorithm(), built(false), upToDate(false)
+{
+
+}
+
+IncrementalWeaklyConnectedComponentsAlgorithm::~IncrementalWeaklyConnectedComponentsAlgorithm()
+{
+    onDiGraphUnset();
+}
+
+bool IncrementalWeaklyConnectedComponentsAlgorithm::sameComponent(const Vertex *u, const Vertex *v)
+{
+    if (!diGraph || !diGraph->containsVertex(u) || !diGraph->containsVertex(v)) {
+        return false;
+    }
+    update();
+    return sets.sameSet((*elementOf)(u), (*elementOf)(v));
+}
+
+DiGraph::size_type IncrementalWeaklyConnectedComponentsAlgorithm::getNumComponents()
+{
+    update();
+    return sets.getNumSets();
+}
+
+void IncrementalWeaklyConnectedComponentsAlgorithm::run()
+{
+    if (hasCompactVertexIds(diGraph)) {
+        elementOf.reset(new FastPropertyMap<DiGraph::size_type>(0U));
+    } else {
+        elementOf.reset(new PropertyMap<DiGraph::size_type>(0U));
+    }
+    sets.reset(0U);
+    diGraph->mapVertices([this](Vertex *v) {
+        elementOf->setValue(v, sets.add());
+    });
+    diGraph->mapArcs([this](Arc *a) {
+        sets.unite((*elementOf)(a->getTail()), (*elementOf)(a->getHead()));
+    });
+    built = true;
+    upToDate = true;
+}
+
+void IncrementalWeaklyConnectedComponentsAlgorithm::onDiGraphSet()
+{
+    built = false;
+    upToDate = false;
+    diGraph->onVertexAdd(this, [this](Vertex *v) {
+        if (isUpToDate()) {
+            elementOf->setValue(v, sets.add());
+        }
+    });
+    diGraph->onArcAdd(this, [this](Arc *a) {
+        if (isUpToDate()) {
+            sets.unite((*elementOf)(a->getTail()), (*elementOf)(a->getHead()));
+        }
+    });
+    diGraph->onVertexRemove(this, [this](Vertex *) {
+        upToDate = false;
+    });
+    diGraph->onArcRemove(this, [this](Arc *) {
+        upToDate = false;
+    });
+}
+
+void IncrementalWeaklyConnectedComponentsAlgorithm::onDiGraphUnset()
+{
+    if (diGraph) {
+        diGraph->removeOnVertexAdd(this);
+        diGraph->removeOnArcAdd(this);
+        diGraph->removeOnVertexRemove(this);
+        diGraph->removeOnArcRemove(this);
+    }
+    built = false;
+    upToDate = false;
+    elementOf.reset();
+    sets.reset(0U);
+}
+
+void IncrementalWeaklyConnectedComponentsAlgorithm::update()
+{
+    if (!isUpToDate()) {
+        run();
+    }
+}
+
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef INCREMENTALWEAKLYCONNECTEDCOMPONENTSALGORITHM_H
+#define INCREMENTALWEAKLYCONNECTEDCOMPONENTSALGORITHM_H
+
+#include "algorithm/digraphalgorithm.h"
+#include "graph/digraph.h"
+#include "datastructure/unionfind.h"
+
+#include <memory>
+
+namespace Algora {
+
+class Vertex;
+
+template<typename T>
+class ModifiableProperty;
+
+/**
+ * Weakly connected components under arc and vertex insertions.
+ * Once run() has been called, insertions into the graph are absorbed into
+ * a union-find structure as they happen. Removals may split components;
+ * they mark the structure as outdated, and the next query rebuilds it.
+ */
+class IncrementalWeaklyConnectedComponentsAlgorithm : public DiGraphAlgorithm
+{
+public:
+    IncrementalWeaklyConnectedComponentsAlgorithm();
+    virtual ~IncrementalWeaklyConnectedComponentsAlgorithm() override;
+
+    bool isUpToDate() const { return built && upToDate; }
+    // false if u or v is not in the graph
+    bool sameComponent(const Vertex *u, const Vertex *v);
+    DiGraph::size_type getNumComponents();
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Incremental Weakly Connected Components"; }
+    virtual std::string getShortName() const noexcept override { return "inc-wcc"; }
+
+protected:
+    virtual void onDiGraphSet() override;
+    virtual void onDiGraphUnset() override;
+
+private:
+    UnionFind sets;
+    std::unique_ptr<ModifiableProperty<DiGraph::size_type>> elementOf;
+    bool built;
+    bool upToDate;
+
+    void update();
+};
+
+}
+
+#endif // INCREMENTALWEAKLYCONNECTEDCOMPONENTSALGORITHM_H
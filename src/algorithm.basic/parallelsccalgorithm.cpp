@@ -0,0 +1,402 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "parallelsccalgorithm.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "graph.static/staticdigraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "algorithm/digraphdispatch.h"
+#include "parallel/threadpool.h"
+#include "property/fastpropertymap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace Algora {
+
+namespace {
+
+typedef DiGraph::size_type size_type;
+const size_type UNSET = std::numeric_limits<size_type>::max();
+
+// frontiers and work lists below this size are handled by the calling thread
+const size_type SEQUENTIAL_THRESHOLD = 1024U;
+// stop trimming once a round removes less than 1/TRIM_STALL of the active vertices
+const size_type TRIM_STALL = 100U;
+// stop forward-backward search once a component has less than 1/PIVOT_STALL of them
+const size_type PIVOT_STALL = 64U;
+
+const std::uint8_t FORWARD = 1U;
+const std::uint8_t BACKWARD = 2U;
+
+template<typename GraphType>
+class SCCEngine {
+public:
+    SCCEngine(GraphType *graph, ThreadPool &pool, std::vector<size_type> &sccOf)
+        : graph(graph), pool(pool), n(graph->getSize()), sccOf(sccOf), nextScc(0U),
+          marks(new std::atomic<std::uint8_t>[n]),
+          local(pool.getNumThreads())
+    {
+        sccOf.assign(n, UNSET);
+        forAll(n, [this](size_type i) { marks[i].store(0U, std::memory_order_relaxed); });
+        active.resize(n);
+        forAll(n, [this](size_type i) { active[i] = i; });
+    }
+
+    size_type run()
+    {
+        while (!active.empty()) {
+            trim();
+            if (active.empty()) {
+                break;
+            }
+            auto before = active.size();
+            auto size = forwardBackward(pivot());
+            compact();
+            if (size * PIVOT_STALL < before) {
+                break;
+            }
+        }
+        tarjan();
+        return nextScc;
+    }
+
+private:
+    struct alignas(64) LocalBuffer {
+        std::vector<size_type> items;
+        size_type best = UNSET;
+        size_type bestScore = 0U;
+    };
+
+    GraphType *graph;
+    ThreadPool &pool;
+    size_type n;
+    std::vector<size_type> &sccOf;
+    size_type nextScc;
+    std::unique_ptr<std::atomic<std::uint8_t>[]> marks;
+    std::vector<size_type> active;
+    std::vector<char> flags;
+    std::vector<size_type> frontier;
+    std::vector<LocalBuffer> local;
+
+    template<typename F>
+    void forAll(size_type count, const F &f) {
+        if (count < SEQUENTIAL_THRESHOLD) {
+            for (size_type i = 0U; i < count; i++) {
+                f(i);
+            }
+        } else {
+            pool.parallelFor(0U, count, f);
+        }
+    }
+
+    // calls f(t, i) for all i in [0, count), with t the index of the executing thread
+    template<typename F>
+    unsigned forAllChunked(size_type count, const F &f) {
+        if (count < SEQUENTIAL_THRESHOLD) {
+            for (size_type i = 0U; i < count; i++) {
+                f(0U, i);
+            }
+            return 1U;
+        }
+        pool.run([this,count,&f](unsigned t) {
+            for (auto i = pool.chunkBegin(0U, count, t), e = pool.chunkBegin(0U, count, t + 1U);
+                 i < e; i++) {
+                f(t, i);
+            }
+        });
+        return pool.getNumThreads();
+    }
+
+    size_type index(const Vertex *v) const {
+        return vertexIndexOf(graph, v);
+    }
+
+    bool alive(const Vertex *v) const {
+        return sccOf[index(v)] == UNSET;
+    }
+
+    // whether v has an unassigned in- or out-neighbor other than itself
+    bool hasLiveNeighbor(const Vertex *v, bool out) const {
+        auto check = [this,v,out](Arc *a) {
+            const Vertex *u = out ? a->getHead() : a->getTail();
+            return u == v || !alive(u);
+        };
+        return out ? !graph->forEachOutgoing(v, check) : !graph->forEachIncoming(v, check);
+    }
+
+    void trim()
+    {
+        while (!active.empty()) {
+            flags.assign(active.size(), 0);
+            forAll(active.size(), [this](size_type i) {
+                const Vertex *v = graph->vertexAt(active[i]);
+                flags[i] = !hasLiveNeighbor(v, false) || !hasLiveNeighbor(v, true);
+            });
+            size_type trimmed = 0U;
+            for (size_type i = 0U; i < active.size(); i++) {
+                if (flags[i]) {
+                    sccOf[active[i]] = nextScc++;
+                    trimmed++;
+                }
+            }
+            compact();
+            if (trimmed == 0U || trimmed * TRIM_STALL < active.size()) {
+                break;
+            }
+        }
+    }
+
+    void compact()
+    {
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [this](size_type i) { return sccOf[i] != UNSET; }),
+                     active.end());
+    }
+
+    size_type pivot()
+    {
+        for (auto &l : local) {
+            l.best = UNSET;
+            l.bestScore = 0U;
+        }
+        forAllChunked(active.size(), [this](unsigned t, size_type i) {
+            const Vertex *v = graph->vertexAt(active[i]);
+            size_type score = (graph->getOutDegree(v, true) + 1U) * (graph->getInDegree(v, true) + 1U);
+            auto &l = local[t];
+            if (l.best == UNSET || score > l.bestScore) {
+                l.best = active[i];
+                l.bestScore = score;
+            }
+        });
+        size_type best = active.front();
+        size_type bestScore = 0U;
+        for (auto &l : local) {
+            if (l.best != UNSET && l.bestScore > bestScore) {
+                best = l.best;
+                bestScore = l.bestScore;
+            }
+        }
+        return best;
+    }
+
+    void search(size_type source, std::uint8_t mark)
+    {
+        frontier.clear();
+        frontier.push_back(source);
+        marks[source].fetch_or(mark, std::memory_order_relaxed);
+        while (!frontier.empty()) {
+            for (auto &l : local) {
+                l.items.clear();
+            }
+            unsigned used = forAllChunked(frontier.size(), [this,mark](unsigned t, size_type i) {
+                auto &next = local[t].items;
+                auto visit = [this,mark,&next](const Vertex *u) {
+                    auto j = index(u);
+                    if (sccOf[j] != UNSET
+                            || (marks[j].load(std::memory_order_relaxed) & mark)) {
+                        return;
+                    }
+                    if (!(marks[j].fetch_or(mark, std::memory_order_relaxed) & mark)) {
+                        next.push_back(j);
+                    }
+                };
+                const Vertex *v = graph->vertexAt(frontier[i]);
+                if (mark == FORWARD) {
+                    graph->forEachOutgoing(v, [&visit](Arc *a) { visit(a->getHead()); });
+                } else {
+                    graph->forEachIncoming(v, [&visit](Arc *a) { visit(a->getTail()); });
+                }
+            });
+            frontier.clear();
+            for (unsigned t = 0U; t < used; t++) {
+                frontier.insert(frontier.end(), local[t].items.begin(), local[t].items.end());
+            }
+        }
+    }
+
+    // returns the size of the component of p
+    size_type forwardBackward(size_type p)
+    {
+        search(p, FORWARD);
+        search(p, BACKWARD);
+        size_type scc = nextScc++;
+        for (auto &l : local) {
+            l.bestScore = 0U;
+        }
+        forAllChunked(active.size(), [this,scc](unsigned t, size_type i) {
+            auto j = active[i];
+            if (marks[j].load(std::memory_order_relaxed) == (FORWARD | BACKWARD)) {
+                sccOf[j] = scc;
+                local[t].bestScore++;
+            }
+            marks[j].store(0U, std::memory_order_relaxed);
+        });
+        size_type size = 0U;
+        for (auto &l : local) {
+            size += l.bestScore;
+        }
+        return size;
+    }
+
+    // iterative Tarjan on the subgraph induced by the unassigned vertices
+    void tarjan()
+    {
+        if (active.empty()) {
+            return;
+        }
+        std::vector<size_type> vertexIndex(n, UNSET);
+        std::vector<size_type> lowLink(n, UNSET);
+        std::vector<size_type> stack;
+        struct CallStackEntry {
+            size_type vertex;
+            size_type other;
+            bool finish;
+        };
+        std::vector<CallStackEntry> callStack;
+        size_type nextIndex = 0U;
+
+        auto strongconnect = [&](size_type v, size_type parent) {
+            vertexIndex[v] = lowLink[v] = nextIndex++;
+            stack.push_back(v);
+            callStack.push_back(CallStackEntry{ v, parent, true });
+            auto first = callStack.size();
+            graph->forEachOutgoing(graph->vertexAt(v), [&](Arc *a) {
+                auto w = index(a->getHead());
+                if (sccOf[w] == UNSET) {
+                    callStack.push_back(CallStackEntry{ v, w, false });
+                }
+            });
+            std::reverse(callStack.begin() + first, callStack.end());
+        };
+
+        for (auto root : active) {
+            if (vertexIndex[root] != UNSET) {
+                continue;
+            }
+            strongconnect(root, UNSET);
+            while (!callStack.empty()) {
+                CallStackEntry e = callStack.back();
+                callStack.pop_back();
+                auto v = e.vertex;
+                if (!e.finish) {
+                    auto w = e.other;
+                    if (vertexIndex[w] == UNSET) {
+                        strongconnect(w, v);
+                    } else if (sccOf[w] == UNSET && vertexIndex[w] < lowLink[v]) {
+                        lowLink[v] = vertexIndex[w];
+                    }
+                    continue;
+                }
+                if (lowLink[v] == vertexIndex[v]) {
+                    size_type w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        sccOf[w] = nextScc;
+                    } while (w != v);
+                    nextScc++;
+                }
+                auto parent = e.other;
+                if (parent != UNSET && lowLink[v] < lowLink[parent]) {
+                    lowLink[parent] = lowLink[v];
+                }
+            }
+        }
+        active.clear();
+    }
+};
+
+}
+
+ParallelSCCAlgorithm::ParallelSCCAlgorithm(bool computeValues)
+    : PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>(computeValues),
+      numSccs(0U), numThreads(0U), pool(nullptr)
+{
+
+}
+
+ParallelSCCAlgorithm::~ParallelSCCAlgorithm()
+{
+
+}
+
+void ParallelSCCAlgorithm::setNumThreads(unsigned n)
+{
+    numThreads = n;
+    ownPool.reset();
+}
+
+ThreadPool &ParallelSCCAlgorithm::threadPool()
+{
+    if (pool) {
+        return *pool;
+    }
+    if (!ownPool) {
+        ownPool.reset(new ThreadPool(numThreads));
+    }
+    return *ownPool;
+}
+
+template<typename GraphType>
+DiGraph::size_type ParallelSCCAlgorithm::computeSccs(GraphType *graph,
+                                                     std::vector<DiGraph::size_type> &sccOf)
+{
+    SCCEngine<GraphType> engine(graph, threadPool(), sccOf);
+    return engine.run();
+}
+
+void ParallelSCCAlgorithm::run()
+{
+    std::vector<DiGraph::size_type> sccOf;
+    if (auto *ilGraph = dynamic_cast<IncidenceListGraph*>(diGraph)) {
+        numSccs = computeSccs(ilGraph, sccOf);
+        if (computePropertyValues) {
+            for (DiGraph::size_type i = 0U; i < sccOf.size(); i++) {
+                property->setValue(ilGraph->vertexAt(i), sccOf[i]);
+            }
+        }
+    } else if (auto *staticGraph = dynamic_cast<StaticDiGraph*>(diGraph)) {
+        numSccs = computeSccs(staticGraph, sccOf);
+        if (computePropertyValues) {
+            for (DiGraph::size_type i = 0U; i < sccOf.size(); i++) {
+                property->setValue(staticGraph->vertexAt(i), sccOf[i]);
+            }
+        }
+    } else {
+        FastPropertyMap<GraphArtifact*> original(nullptr);
+        StaticDiGraph snapshot;
+        snapshot.assign(diGraph, nullptr, nullptr, &original);
+        numSccs = computeSccs(&snapshot, sccOf);
+        if (computePropertyValues) {
+            for (DiGraph::size_type i = 0U; i < sccOf.size(); i++) {
+                property->setValue(original(snapshot.vertexAt(i)), sccOf[i]);
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef PARALLELSCCALGORITHM_H
+#define PARALLELSCCALGORITHM_H
+
+#include "algorithm/propertycomputingalgorithm.h"
+#include "graph/digraph.h"
+
+#include <memory>
+#include <vector>
+
+namespace Algora {
+
+class ThreadPool;
+
+/**
+ * Strongly connected components for large graphs.
+ * Trivial components are trimmed in parallel, large components are found
+ * by forward-backward search from a pivot with parallel BFS, and the
+ * remainder is handled by an iterative Tarjan.
+ * Unlike TarjanSCCAlgorithm, component numbers are not topologically ordered.
+ */
+class ParallelSCCAlgorithm : public PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>
+{
+public:
+    explicit ParallelSCCAlgorithm(bool computeValues = true);
+    virtual ~ParallelSCCAlgorithm() override;
+
+    // 0 uses all hardware threads
+    void setNumThreads(unsigned n);
+    // use an external pool instead of an own one; nullptr reverts to an own pool
+    void useThreadPool(ThreadPool *threadPool) { pool = threadPool; }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Parallel SCC"; }
+    virtual std::string getShortName() const noexcept override { return "par-scc"; }
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual DiGraph::size_type deliver() override { return numSccs; }
+
+private:
+    DiGraph::size_type numSccs;
+    unsigned numThreads;
+    ThreadPool *pool;
+    std::unique_ptr<ThreadPool> ownPool;
+
+    ThreadPool &threadPool();
+    template<typename GraphType>
+    DiGraph::size_type computeSccs(GraphType *graph, std::vector<DiGraph::size_type> &sccOf);
+};
+
+}
+
+#endif // PARALLELSCCALGORITHM_H
@@ -23,9 +23,15 @@
 #include "radiusdiameteralgorithm.h"
 
 #include "eccentricityalgorithm.h"
+#include "algorithm.basic.traversal/breadthfirstsearch.h"
+#include "algorithm.basic.traversal/multisourcebfs.h"
 #include "graph/digraph.h"
+#include "graph.static/staticdigraph.h"
+#include "property/fastpropertymap.h"
 
+#include <algorithm>
 #include <climits>
+#include <vector>
 
 namespace Algora {
 
@@ -33,7 +39,8 @@ const int RadiusDiameterAlgorithm::INFINITE = INT_MAX;
 
 RadiusDiameterAlgorithm::RadiusDiameterAlgorithm(bool radiusOnly, bool diameterOnly)
     : ValueComputingAlgorithm<int>(), radius(INFINITE), diameter(INFINITE),
-      radOrDiam(true), radOnly(radiusOnly), diamOnly(diameterOnly)
+      radOrDiam(true), radOnly(radiusOnly), diamOnly(diameterOnly),
+      bounding(true), multiSource(true), directionOptimizing(true)
 {
 
 }
@@ -42,24 +49,230 @@ void RadiusDiameterAlgorithm::run()
 {
     radius = INT_MAX;
     diameter = -1;
+    if (bounding) {
+        runWithBounds();
+    } else if (multiSource) {
+        runMultiSource();
+    } else {
+        runSingleSource();
+    }
+}
+
+void RadiusDiameterAlgorithm::runWithBounds()
+{
+    typedef DiGraph::size_type size_type;
+    const size_type INF = BreadthFirstSearch<>::INF;
+    // bounding steps that resolve fewer candidates than this on average
+    // are outrun by exact multi-source BFS batches
+    const size_type WINDOW = 4U;
+    const size_type MIN_RESOLVED_PER_STEP = 32U;
+
+    StaticDiGraph snapshot;
+    StaticDiGraph *graph = dynamic_cast<StaticDiGraph*>(diGraph);
+    if (!graph) {
+        snapshot.assign(diGraph);
+        graph = &snapshot;
+    }
+    size_type n = graph->getSize();
+    if (n == 0U) {
+        return;
+    }
+
+    bool wantRadius = !diamOnly || radOnly;
+    bool wantDiameter = !radOnly || diamOnly;
+
+    // ecc(w) >= d(w,v), ecc(w) >= ecc(v) - d(v,w), ecc(w) <= d(w,v) + ecc(v)
+    std::vector<size_type> lower(n, 0U);
+    std::vector<size_type> upper(n, INF);
+    std::vector<size_type> diamCandidates;
+    std::vector<size_type> radCandidates;
+
+    auto collectCandidates = [&]() {
+        size_type lowMax = 0U;
+        size_type upMin = INF;
+        for (size_type w = 0U; w < n; w++) {
+            lowMax = std::max(lowMax, lower[w]);
+            upMin = std::min(upMin, upper[w]);
+        }
+        diameter = lowMax == INF ? INFINITE : static_cast<int>(lowMax);
+        radius = upMin == INF ? INFINITE : static_cast<int>(upMin);
+
+        diamCandidates.clear();
+        radCandidates.clear();
+        for (size_type w = 0U; w < n; w++) {
+            if (lower[w] == upper[w]) {
+                continue;
+            }
+            if (wantDiameter && upper[w] > lowMax) {
+                diamCandidates.push_back(w);
+            }
+            if (wantRadius && lower[w] < upMin) {
+                radCandidates.push_back(w);
+            }
+        }
+        return diamCandidates.size() + radCandidates.size();
+    };
+    auto byUpper = [&](size_type a, size_type b) {
+        return upper[a] > upper[b] || (upper[a] == upper[b] && lower[a] > lower[b]);
+    };
+    auto byLower = [&](size_type a, size_type b) {
+        return lower[a] < lower[b] || (lower[a] == lower[b] && upper[a] < upper[b]);
+    };
+
+    FastPropertyMap<size_type> from(INF);
+    FastPropertyMap<size_type> to(INF);
+    BreadthFirstSearch<FastPropertyMap, true> forward;
+    BreadthFirstSearch<FastPropertyMap, true, true> backward;
+    forward.levelAsValues(true);
+    backward.levelAsValues(true);
+    forward.useDirectionOptimization(directionOptimizing);
+    backward.useDirectionOptimization(directionOptimizing);
+    forward.useModifiableProperty(&from);
+    backward.useModifiableProperty(&to);
+
+    size_type v = 0U;
+    size_type maxDegree = 0U;
+    for (size_type i = 0U; i < n; i++) {
+        size_type deg = graph->outEnd(i) - graph->outBegin(i) + graph->inEnd(i) - graph->inBegin(i);
+        if (deg > maxDegree) {
+            maxDegree = deg;
+            v = i;
+        }
+    }
+
+    std::vector<size_type> numCandidates;
+    bool pickHigh = true;
+    while (true) {
+        Vertex *source = graph->vertexAt(v);
+        from.resetAll();
+        to.resetAll();
+        forward.setStartVertex(source);
+        backward.setStartVertex(source);
+        size_type reached = runAlgorithm(forward, graph);
+        runAlgorithm(backward, graph);
+        size_type ecc = reached == n ? forward.getMaxLevel() : INF;
+
+        for (size_type w = 0U; w < n; w++) {
+            const Vertex *vw = graph->vertexAt(w);
+            size_type dFrom = from(vw);
+            size_type dTo = to(vw);
+            size_type l = dTo;
+            if (dFrom != INF && (ecc == INF || ecc > dFrom)) {
+                l = std::max(l, ecc == INF ? INF : ecc - dFrom);
+            }
+            lower[w] = std::max(lower[w], l);
+            upper[w] = std::min(upper[w], (dTo == INF || ecc == INF) ? INF : dTo + ecc);
+        }
+
+        size_type c = collectCandidates();
+        if (c == 0U) {
+            return;
+        }
+        numCandidates.push_back(c);
+        auto steps = numCandidates.size();
+        if (steps > WINDOW
+                && numCandidates[steps - WINDOW - 1U] - c < WINDOW * MIN_RESOLVED_PER_STEP) {
+            break;
+        }
+
+        // alternate between peripheral and central vertices:
+        // the former yield good lower bounds, the latter good upper bounds
+        const auto &high = diamCandidates.empty() ? radCandidates : diamCandidates;
+        const auto &low = radCandidates.empty() ? diamCandidates : radCandidates;
+        if (pickHigh) {
+            v = *std::min_element(high.begin(), high.end(), byUpper);
+        } else {
+            v = *std::min_element(low.begin(), low.end(), byLower);
+        }
+        pickHigh = !pickHigh;
+    }
+
+    // resolve the remaining candidates exactly, most promising ones first
+    MultiSourceBFS msBfs(graph);
+    std::vector<size_type> sources;
+    std::vector<bool> chosen(n, false);
+    while (collectCandidates() > 0U) {
+        std::sort(diamCandidates.begin(), diamCandidates.end(), byUpper);
+        std::sort(radCandidates.begin(), radCandidates.end(), byLower);
+        sources.clear();
+        auto take = [&](std::vector<size_type>::const_iterator &it,
+                std::vector<size_type>::const_iterator end) {
+            if (it != end && sources.size() < MultiSourceBFS::MAX_SOURCES) {
+                if (!chosen[*it]) {
+                    chosen[*it] = true;
+                    sources.push_back(*it);
+                }
+                ++it;
+            }
+        };
+        std::vector<size_type>::const_iterator d = diamCandidates.cbegin();
+        std::vector<size_type>::const_iterator r = radCandidates.cbegin();
+        while (sources.size() < MultiSourceBFS::MAX_SOURCES
+               && (d != diamCandidates.cend() || r != radCandidates.cend())) {
+            take(d, diamCandidates.cend());
+            take(r, radCandidates.cend());
+        }
+        msBfs.run(sources);
+        for (unsigned i = 0U; i < sources.size(); i++) {
+            size_type e = msBfs.reachedAll(i) ? msBfs.getMaxLevel(i) : INF;
+            lower[sources[i]] = upper[sources[i]] = e;
+            chosen[sources[i]] = false;
+        }
+    }
+}
+
+void RadiusDiameterAlgorithm::runSingleSource()
+{
     EccentricityAlgorithm ecc;
+    ecc.useDirectionOptimization(directionOptimizing);
     bool stop = false;
     diGraph->mapVerticesUntil([&](Vertex *v) {
         ecc.setVertex(v);
-        int e = runAlgorithm(ecc, diGraph);
-        if (e > diameter) {
-            diameter = e;
-            if (diamOnly && diameter == INFINITE) {
-                stop = true;
-            }
+        stop = update(runAlgorithm(ecc, diGraph));
+    }, [&stop](const Vertex *) { return stop; });
+}
+
+void RadiusDiameterAlgorithm::runMultiSource()
+{
+    StaticDiGraph snapshot;
+    const StaticDiGraph *graph = dynamic_cast<StaticDiGraph*>(diGraph);
+    if (!graph) {
+        snapshot.assign(diGraph);
+        graph = &snapshot;
+    }
+
+    MultiSourceBFS msBfs(graph);
+    std::vector<DiGraph::size_type> sources;
+    DiGraph::size_type n = graph->getSize();
+    bool stop = false;
+    for (DiGraph::size_type first = 0U; first < n && !stop; first += MultiSourceBFS::MAX_SOURCES) {
+        sources.clear();
+        for (DiGraph::size_type i = first; i < n && i < first + MultiSourceBFS::MAX_SOURCES; i++) {
+            sources.push_back(i);
         }
-        if (e < radius) {
-            radius = e;
-            if (radOnly && radius == 1U) {
-                stop = true;
-            }
+        msBfs.run(sources);
+        for (unsigned s = 0U; s < sources.size() && !stop; s++) {
+            stop = update(msBfs.reachedAll(s) ? static_cast<int>(msBfs.getMaxLevel(s)) : INFINITE);
         }
-    }, [&stop](const Vertex *) { return stop; });
+    }
+}
+
+bool RadiusDiameterAlgorithm::update(int e)
+{
+    bool stop = false;
+    if (e > diameter) {
+        diameter = e;
+        if (diamOnly && diameter == INFINITE) {
+            stop = true;
+        }
+    }
+    if (e < radius) {
+        radius = e;
+        if (radOnly && radius == 1U) {
+            stop = true;
+        }
+    }
+    return stop;
 }
 
 void RadiusDiameterAlgorithm::onDiGraphSet()
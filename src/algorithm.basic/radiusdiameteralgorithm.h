@@ -51,6 +51,23 @@ public:
         return radOrDiam;
     }
 
+    // Maintain lower and upper eccentricity bounds and run BFS only from
+    // adaptively chosen vertices until radius and/or diameter are determined.
+    void useEccentricityBounds(bool use) {
+        bounding = use;
+    }
+
+    // run bit-parallel BFS from batches of vertices instead of one BFS per vertex
+    void useMultiSourceBFS(bool use) {
+        multiSource = use;
+    }
+
+    // applies to the eccentricity BFS runs of the default mode and to the forward and backward
+    // BFS runs of useEccentricityBounds(), but not to bit-parallel multi-source BFS batches
+    void useDirectionOptimization(bool use) {
+        directionOptimizing = use;
+    }
+
     // DiGraphAlgorithm interface
 public:
     virtual void run() override;
@@ -70,6 +87,14 @@ private:
     bool radOrDiam;
     bool radOnly;
     bool diamOnly;
+    bool bounding;
+    bool multiSource;
+    bool directionOptimizing;
+
+    void runWithBounds();
+    void runSingleSource();
+    void runMultiSource();
+    bool update(int e);
 };
 
 }
@@ -0,0 +1,283 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "reachabilityindex.h"
+
+#include "tarjansccalgorithm.h"
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "algorithm/digraphdispatch.h"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+namespace Algora {
+
+namespace {
+
+typedef DiGraph::size_type size_type;
+typedef ReachabilityIndex::label_type label_type;
+
+struct Csr {
+    std::vector<size_type> offsets;
+    std::vector<size_type> targets;
+
+    void build(size_type n, const std::vector<std::pair<size_type, size_type>> &arcs) {
+        offsets.assign(n + 1, 0U);
+        for (const auto &a : arcs) {
+            offsets[a.first + 1]++;
+        }
+        for (size_type i = 0U; i < n; i++) {
+            offsets[i + 1] += offsets[i];
+        }
+        targets.resize(arcs.size());
+        std::vector<size_type> pos(offsets.begin(), offsets.end() - 1);
+        for (const auto &a : arcs) {
+            targets[pos[a.first]++] = a.second;
+        }
+    }
+};
+
+class LabelBuilder {
+public:
+    LabelBuilder(size_type n, const Csr &out, const Csr &in)
+        : n(n), out(out), in(in), outLabels(n), inLabels(n),
+          visited(n, 0U), marked(n, 0U), epoch(0U) { }
+
+    void build() {
+        std::vector<size_type> order(n);
+        for (size_type i = 0U; i < n; i++) {
+            order[i] = i;
+        }
+        auto score = [this](size_type v) {
+            return (out.offsets[v + 1] - out.offsets[v] + 1U)
+                    * (in.offsets[v + 1] - in.offsets[v] + 1U);
+        };
+        std::stable_sort(order.begin(), order.end(), [&score](size_type a, size_type b) {
+            return score(a) > score(b);
+        });
+        for (size_type r = 0U; r < n; r++) {
+            search(order[r], static_cast<label_type>(r), out, outLabels, inLabels);
+            search(order[r], static_cast<label_type>(r), in, inLabels, outLabels);
+        }
+    }
+
+    void flatten(std::vector<std::vector<label_type>> &labels,
+                 std::vector<size_type> &offsets, std::vector<label_type> &flat) {
+        offsets.assign(n + 1, 0U);
+        for (size_type i = 0U; i < n; i++) {
+            offsets[i + 1] = offsets[i] + labels[i].size();
+        }
+        flat.clear();
+        flat.reserve(offsets[n]);
+        for (auto &l : labels) {
+            flat.insert(flat.end(), l.begin(), l.end());
+            std::vector<label_type>().swap(l);
+        }
+    }
+
+    std::vector<std::vector<label_type>> &getOutLabels() { return outLabels; }
+    std::vector<std::vector<label_type>> &getInLabels() { return inLabels; }
+
+private:
+    size_type n;
+    const Csr &out;
+    const Csr &in;
+    std::vector<std::vector<label_type>> outLabels;
+    std::vector<std::vector<label_type>> inLabels;
+    std::vector<unsigned> visited;
+    std::vector<unsigned> marked;
+    unsigned epoch;
+    std::vector<size_type> queue;
+
+    // Searches from the landmark with the given rank along arcs and adds the
+    // rank to the reached labels, unless the labels already cover the pair.
+    // sourceLabels are the labels of the landmark on the near side,
+    // reachedLabels those of the reached vertices on the far side.
+    void search(size_type landmark, label_type rank, const Csr &arcs,
+                std::vector<std::vector<label_type>> &sourceLabels,
+                std::vector<std::vector<label_type>> &reachedLabels) {
+        epoch++;
+        for (auto l : sourceLabels[landmark]) {
+            marked[l] = epoch;
+        }
+        queue.clear();
+        queue.push_back(landmark);
+        visited[landmark] = epoch;
+        for (size_type q = 0U; q < queue.size(); q++) {
+            auto v = queue[q];
+            if (v != landmark && covered(reachedLabels[v])) {
+                continue;
+            }
+            reachedLabels[v].push_back(rank);
+            for (auto k = arcs.offsets[v]; k < arcs.offsets[v + 1]; k++) {
+                auto w = arcs.targets[k];
+                if (visited[w] != epoch) {
+                    visited[w] = epoch;
+                    queue.push_back(w);
+                }
+            }
+        }
+    }
+
+    bool covered(const std::vector<label_type> &labels) const {
+        for (auto l : labels) {
+            if (marked[l] == epoch) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+}
+
+ReachabilityIndex::ReachabilityIndex()
+    : DiGraphAlgorithm(), built(false), numSccs(0U)
+{
+
+}
+
+ReachabilityIndex::~ReachabilityIndex()
+{
+
+}
+
+bool ReachabilityIndex::canReach(const Vertex *source, const Vertex *target) const
+{
+    return canReachComponent(getComponent(source), getComponent(target));
+}
+
+bool ReachabilityIndex::canReachComponent(DiGraph::size_type sourceScc,
+                                          DiGraph::size_type targetScc) const
+{
+    if (sourceScc >= numSccs || targetScc >= numSccs) {
+        return false;
+    }
+    if (sourceScc == targetScc) {
+        return true;
+    }
+    // component numbers are topologically ordered
+    if (sourceScc > targetScc) {
+        return false;
+    }
+    auto o = outLabels.begin() + static_cast<std::ptrdiff_t>(outOffsets[sourceScc]);
+    auto oEnd = outLabels.begin() + static_cast<std::ptrdiff_t>(outOffsets[sourceScc + 1]);
+    auto i = inLabels.begin() + static_cast<std::ptrdiff_t>(inOffsets[targetScc]);
+    auto iEnd = inLabels.begin() + static_cast<std::ptrdiff_t>(inOffsets[targetScc + 1]);
+    while (o != oEnd && i != iEnd) {
+        if (*o == *i) {
+            return true;
+        }
+        if (*o < *i) {
+            ++o;
+        } else {
+            ++i;
+        }
+    }
+    return false;
+}
+
+DiGraph::size_type ReachabilityIndex::getComponent(const Vertex *v) const
+{
+    if (!built || !diGraph->containsVertex(v)) {
+        return NO_COMPONENT;
+    }
+    return (*sccOf)(v);
+}
+
+void ReachabilityIndex::run()
+{
+    reset();
+    if (hasCompactVertexIds(diGraph)) {
+        auto *map = new FastPropertyMap<DiGraph::size_type>(NO_COMPONENT);
+        sccOf.reset(map);
+        TarjanSCCAlgorithm<FastPropertyMap> tarjan;
+        tarjan.useModifiableProperty(map);
+        numSccs = runAlgorithm(tarjan, diGraph);
+    } else {
+        auto *map = new PropertyMap<DiGraph::size_type>(NO_COMPONENT);
+        sccOf.reset(map);
+        TarjanSCCAlgorithm<PropertyMap> tarjan;
+        tarjan.useModifiableProperty(map);
+        numSccs = runAlgorithm(tarjan, diGraph);
+    }
+
+    std::vector<std::pair<size_type, size_type>> arcs;
+    diGraph->mapArcs([this,&arcs](Arc *a) {
+        auto tail = (*sccOf)(a->getTail());
+        auto head = (*sccOf)(a->getHead());
+        if (tail != head) {
+            arcs.emplace_back(tail, head);
+        }
+    });
+    std::sort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    Csr out;
+    out.build(numSccs, arcs);
+    for (auto &a : arcs) {
+        std::swap(a.first, a.second);
+    }
+    Csr in;
+    in.build(numSccs, arcs);
+    std::vector<std::pair<size_type, size_type>>().swap(arcs);
+
+    LabelBuilder builder(numSccs, out, in);
+    builder.build();
+    builder.flatten(builder.getOutLabels(), outOffsets, outLabels);
+    builder.flatten(builder.getInLabels(), inOffsets, inLabels);
+    built = true;
+}
+
+std::string ReachabilityIndex::getProfilingInfo() const
+{
+    std::stringstream ss;
+    ss << "#components: " << numSccs << std::endl;
+    ss << "#label entries: " << getLabelSize() << std::endl;
+    return ss.str();
+}
+
+void ReachabilityIndex::onDiGraphSet()
+{
+    reset();
+}
+
+void ReachabilityIndex::onDiGraphUnset()
+{
+    reset();
+}
+
+void ReachabilityIndex::reset()
+{
+    built = false;
+    numSccs = 0U;
+    sccOf.reset();
+    outOffsets.clear();
+    outLabels.clear();
+    inOffsets.clear();
+    inLabels.clear();
+}
+
+}
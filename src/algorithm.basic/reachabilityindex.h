@@ -0,0 +1,99 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef REACHABILITYINDEX_H
+#define REACHABILITYINDEX_H
+
+#include "algorithm/digraphalgorithm.h"
+#include "graph/digraph.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Algora {
+
+class Vertex;
+
+template<typename T>
+class ModifiableProperty;
+
+/**
+ * Answers reachability queries after a one-time build.
+ * The graph is condensed into its strongly connected components, and the
+ * resulting DAG is labeled with pruned 2-hop (landmark) labels.
+ * A query is then a topological order check followed by the intersection
+ * of two short sorted labels.
+ * The index reflects the graph at the time of the last run(); it does not
+ * follow later modifications.
+ */
+class ReachabilityIndex : public DiGraphAlgorithm
+{
+public:
+    typedef std::uint32_t label_type;
+    // component of vertices not in the graph at the time of the last run()
+    static constexpr DiGraph::size_type NO_COMPONENT = std::numeric_limits<DiGraph::size_type>::max();
+
+    ReachabilityIndex();
+    virtual ~ReachabilityIndex() override;
+
+    bool isBuilt() const { return built; }
+    // whether there is a directed path from source to target; requires run()
+    // false if source or target is unknown to the index
+    bool canReach(const Vertex *source, const Vertex *target) const;
+    // same, for component numbers as returned by getComponent()
+    bool canReachComponent(DiGraph::size_type sourceScc, DiGraph::size_type targetScc) const;
+
+    DiGraph::size_type getComponent(const Vertex *v) const;
+    DiGraph::size_type getNumComponents() const { return numSccs; }
+    // total number of label entries
+    DiGraph::size_type getLabelSize() const { return outLabels.size() + inLabels.size(); }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Reachability Index"; }
+    virtual std::string getShortName() const noexcept override { return "ReachIdx"; }
+    virtual std::string getProfilingInfo() const override;
+
+protected:
+    virtual void onDiGraphSet() override;
+    virtual void onDiGraphUnset() override;
+
+private:
+    bool built;
+    DiGraph::size_type numSccs;
+    std::unique_ptr<ModifiableProperty<DiGraph::size_type>> sccOf;
+
+    // labels per component in CSR layout, as landmark ranks in ascending order
+    std::vector<DiGraph::size_type> outOffsets;
+    std::vector<label_type> outLabels;
+    std::vector<DiGraph::size_type> inOffsets;
+    std::vector<label_type> inLabels;
+
+    void reset();
+};
+
+}
+
+#endif // REACHABILITYINDEX_H
@@ -26,7 +26,9 @@
 #include "graph/vertex.h"
 #include "graph/arc.h"
 #include "property/propertymap.h"
+#include "algorithm/digraphdispatch.h"
 
+#include <algorithm>
 #include <vector>
 #include <limits>
 
@@ -46,24 +48,26 @@ namespace Algora {
 
 namespace  {
 const static DiGraph::size_type UNSET = std::numeric_limits<DiGraph::size_type>::max();
+const static DiGraph::size_type DONE = UNSET - 1;
+
+// per-vertex state of Tarjan's algorithm, packed into one record
+struct TarjanRecord {
+    DiGraph::size_type index = UNSET;
+    // DONE once the vertex has been assigned to an SCC, i.e., left the stack
+    DiGraph::size_type lowLink = UNSET;
+};
 }
 
-template <template<typename T> class ModifiablePropertyType = PropertyMap>
-DiGraph::size_type tarjanRecursive(DiGraph *diGraph,
+template <template<typename T> class ModifiablePropertyType = PropertyMap, typename GraphType = DiGraph>
+DiGraph::size_type tarjanIterative(GraphType *diGraph,
                                    ModifiableProperty<DiGraph::size_type> &sccNumber);
 
-void strongconnect(DiGraph *graph, Vertex *v,
-                   DiGraph::size_type &nextIndex, DiGraph::size_type &nextScc,
-                   std::vector<Vertex*> &stack,
-                   ModifiableProperty<DiGraph::size_type> &vertexIndex,
-                   ModifiableProperty<DiGraph::size_type> &lowLink,
-                   ModifiableProperty<bool> &onStack,
-                   ModifiableProperty<DiGraph::size_type> &sccNumber);
-
 template <template<typename T> class ModifiablePropertyType>
 void TarjanSCCAlgorithm<ModifiablePropertyType>::run()
 {
-    numSccs = tarjanRecursive<ModifiablePropertyType>(diGraph, *this->property);
+    numSccs = dispatchDiGraph(diGraph, [this](auto *graph) {
+        return tarjanIterative<ModifiablePropertyType>(graph, *this->property);
+    });
 
     if (numSccs > 1) {
         diGraph->mapVertices([&](Vertex *v) {
@@ -73,81 +77,93 @@ void TarjanSCCAlgorithm<ModifiablePropertyType>::run()
     }
 }
 
-template <template<typename T> class ModifiablePropertyType>
-GraphArtifact::size_type tarjanRecursive(DiGraph *diGraph,
-                                         ModifiableProperty<DiGraph::size_type> &sccNumber) {
+template <template<typename T> class ModifiablePropertyType, typename GraphType>
+DiGraph::size_type tarjanIterative(GraphType *diGraph,
+                                   ModifiableProperty<DiGraph::size_type> &sccNumber) {
     DiGraph::size_type nextIndex = 0;
     DiGraph::size_type nextScc = 0;
-    std::vector<Vertex*> stack;
-    ModifiablePropertyType<DiGraph::size_type> vertexIndex(UNSET);
-    ModifiablePropertyType<DiGraph::size_type> lowLink(UNSET);
-    ModifiablePropertyType<bool> onStack(false);
-
-    diGraph->mapVertices([&](Vertex *v) {
-        if (vertexIndex(v) == UNSET) {
-            strongconnect(diGraph, v, nextIndex, nextScc, stack, vertexIndex, lowLink, onStack, sccNumber);
+    std::vector<const Vertex*> stack;
+    ModifiablePropertyType<TarjanRecord> record(TarjanRecord{});
+
+    // Arcs (vertex, other) still to be considered, topmost first, and
+    // finish markers (vertex, parent) for the vertices on the call path.
+    struct CallStackEntry {
+        const Vertex *vertex;
+        const Vertex *other;
+        bool finish;
+    };
+    std::vector<CallStackEntry> callStack;
+
+    auto strongconnect = [&](const Vertex *v, const Vertex *parent) {
+        PRINT_DEBUG( "strongconnect on " << v )
+        record[v] = TarjanRecord{ nextIndex, nextIndex };
+        PRINT_DEBUG( "index and lowlink are " << nextIndex )
+        nextIndex++;
+        stack.push_back(v);
+
+        callStack.push_back(CallStackEntry{ v, parent, true });
+        auto first = callStack.size();
+        diGraph->forEachOutgoing(v, [&](Arc *a) {
+            callStack.push_back(CallStackEntry{ v, a->getHead(), false });
+        });
+        std::reverse(callStack.begin() + first, callStack.end());
+    };
+
+    diGraph->mapVertices([&](Vertex *root) {
+        if (record(root).index != UNSET) {
+            return;
         }
-    });
-    return nextScc;
-}
+        strongconnect(root, nullptr);
+
+        while (!callStack.empty()) {
+            CallStackEntry e = callStack.back();
+            callStack.pop_back();
+
+            const Vertex *v = e.vertex;
+            if (!e.finish) {
+                const Vertex *head = e.other;
+                PRINT_DEBUG( "considering out-neighbor " << head << " of " << v )
+                auto h = record(head);
+                if (h.index == UNSET) {
+                    PRINT_DEBUG( "neighbor has no index yet." )
+                    strongconnect(head, v);
+                } else if (h.lowLink != DONE && h.index < record(v).lowLink) {
+                    PRINT_DEBUG( "neighbor is on stack and has index " << h.index )
+                    record[v].lowLink = h.index;
+                }
+                continue;
+            }
 
-void strongconnect(DiGraph *graph, Vertex *v,
-                   GraphArtifact::size_type &nextIndex, GraphArtifact::size_type &nextScc,
-                   std::vector<Vertex *> &stack,
-                   ModifiableProperty<DiGraph::size_type> &vertexIndex,
-                   ModifiableProperty<DiGraph::size_type> &lowLink,
-                   ModifiableProperty<bool> &onStack,
-                   ModifiableProperty<DiGraph::size_type> &sccNumber) {
-
-    PRINT_DEBUG( "strongconnect on " << v )
-    auto vLowLink = nextIndex;
-    vertexIndex.setValue(v, nextIndex);
-    lowLink.setValue(v, nextIndex);
-    PRINT_DEBUG( "index is " << nextIndex )
-    PRINT_DEBUG( "lolink is " << nextIndex )
-    nextIndex++;
-    stack.push_back(v);
-    onStack.setValue(v, true);
-
-    graph->mapOutgoingArcs(v, [&](Arc *a) {
-        Vertex *head = a->getHead();
-        PRINT_DEBUG( "considering out-neighbor " << head )
-        if (vertexIndex(head) == UNSET) {
-            PRINT_DEBUG( "neighbor has no index yet." )
-            strongconnect(graph, head, nextIndex, nextScc, stack, vertexIndex, lowLink, onStack, sccNumber);
-            auto hLowLink = lowLink(head);
-            PRINT_DEBUG( "neighbor has lowlink " << hLowLink )
-            if (hLowLink < vLowLink) {
-                vLowLink = hLowLink;
-                PRINT_DEBUG( "lowlink updated." )
+            const Vertex *parent = e.other;
+            auto rv = record(v);
+            auto vLowLink = rv.lowLink;
+
+            if (vLowLink == rv.index) {
+                PRINT_DEBUG_CL( "Found SCC #" << nextScc << " with members: " )
+                const Vertex *w;
+                do {
+                    w = stack.back();
+                    PRINT_DEBUG_CL( w << " " );
+                    stack.pop_back();
+                    record[w].lowLink = DONE;
+                    sccNumber.setValue(w, nextScc);
+                } while (w != v);
+                PRINT_DEBUG( "" )
+                nextScc++;
             }
-        } else if (onStack(head)) {
-            PRINT_DEBUG( "neighbor is already on stack." )
-            auto hIndex = vertexIndex(head);
-            PRINT_DEBUG( "neighbor has index " << hIndex )
-            if (hIndex < vLowLink) {
-                vLowLink = hIndex;
-                PRINT_DEBUG( "lowlink updated." )
+            if (parent) {
+                TarjanRecord &rp = record[parent];
+                if (vLowLink < rp.lowLink) {
+                    rp.lowLink = vLowLink;
+                    PRINT_DEBUG( "lowlink of " << parent << " updated." )
+                }
             }
+            PRINT_DEBUG( "done with " << v )
         }
     });
-    lowLink.setValue(v, vLowLink);
-
-    if (lowLink(v) == vertexIndex(v)) {
-        PRINT_DEBUG_CL( "Found SCC #" << nextScc << " with members: " )
-        Vertex *w;
-        do {
-            w  = stack.back();
-            PRINT_DEBUG_CL( w << " " );
-            stack.pop_back();
-            onStack.setValue(w, false);
-            sccNumber.setValue(w, nextScc);
-        } while (w != v);
-        PRINT_DEBUG( "" )
-        nextScc++;
-    }
-    PRINT_DEBUG( "done with " << v )
+    return nextScc;
 }
+
 template class TarjanSCCAlgorithm<PropertyMap>;
 template class TarjanSCCAlgorithm<FastPropertyMap>;
 
@@ -0,0 +1,178 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "weaklyconnectedcomponentsalgorithm.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "graph.static/staticdigraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "algorithm/digraphdispatch.h"
+#include "datastructure/concurrentunionfind.h"
+#include "parallel/threadpool.h"
+#include "property/fastpropertymap.h"
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace Algora {
+
+namespace {
+
+typedef DiGraph::size_type size_type;
+
+// number of outgoing arcs per vertex used for the initial linking
+const size_type NEIGHBOR_ROUNDS = 2U;
+const size_type NUM_SAMPLES = 1024U;
+
+}
+
+WeaklyConnectedComponentsAlgorithm::WeaklyConnectedComponentsAlgorithm(bool computeValues)
+    : PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>(computeValues),
+      numComponents(0U), numThreads(0U), pool(nullptr), sequentialThreshold(1U << 14)
+{
+
+}
+
+WeaklyConnectedComponentsAlgorithm::~WeaklyConnectedComponentsAlgorithm()
+{
+
+}
+
+void WeaklyConnectedComponentsAlgorithm::setNumThreads(unsigned n)
+{
+    numThreads = n;
+    ownPool.reset();
+}
+
+ThreadPool &WeaklyConnectedComponentsAlgorithm::threadPool()
+{
+    if (pool) {
+        return *pool;
+    }
+    if (!ownPool) {
+        ownPool.reset(new ThreadPool(numThreads));
+    }
+    return *ownPool;
+}
+
+template<typename GraphType>
+DiGraph::size_type WeaklyConnectedComponentsAlgorithm::computeComponents(
+        GraphType *graph, std::vector<DiGraph::size_type> &componentOf)
+{
+    const size_type n = graph->getSize();
+    ConcurrentUnionFind sets(n);
+    auto forAll = [this,n](auto &&f) {
+        if (n < sequentialThreshold) {
+            for (size_type i = 0U; i < n; i++) {
+                f(i);
+            }
+        } else {
+            threadPool().parallelFor(0U, n, f);
+        }
+    };
+
+    // link along the first outgoing arcs
+    forAll([&](size_type i) {
+        size_type k = 0U;
+        graph->forEachOutgoing(graph->vertexAt(i), [&](Arc *a) {
+            sets.unite(i, vertexIndexOf(graph, a->getHead()));
+            return ++k < NEIGHBOR_ROUNDS;
+        });
+    });
+
+    // most frequent intermediate component
+    size_type largest = n;
+    if (n > 0U) {
+        std::mt19937_64 rng(n);
+        std::unordered_map<size_type, size_type> counts;
+        size_type best = 0U;
+        for (size_type s = 0U; s < NUM_SAMPLES; s++) {
+            auto root = sets.find(rng() % n);
+            auto c = ++counts[root];
+            if (c > best) {
+                best = c;
+                largest = root;
+            }
+        }
+    }
+
+    // remaining arcs of all vertices outside of it; arcs between two vertices
+    // of the largest component are irrelevant, all others are seen from one end
+    forAll([&](size_type i) {
+        if (sets.find(i) == largest) {
+            return;
+        }
+        const Vertex *v = graph->vertexAt(i);
+        size_type k = 0U;
+        graph->forEachOutgoing(v, [&](Arc *a) {
+            if (k++ >= NEIGHBOR_ROUNDS) {
+                sets.unite(i, vertexIndexOf(graph, a->getHead()));
+            }
+        });
+        graph->forEachIncoming(v, [&](Arc *a) {
+            sets.unite(i, vertexIndexOf(graph, a->getTail()));
+        });
+    });
+
+    // roots are minimal elements, so every root precedes the rest of its set
+    componentOf.resize(n);
+    size_type next = 0U;
+    for (size_type i = 0U; i < n; i++) {
+        auto root = sets.find(i);
+        componentOf[i] = root == i ? next++ : componentOf[root];
+    }
+    return next;
+}
+
+void WeaklyConnectedComponentsAlgorithm::run()
+{
+    std::vector<DiGraph::size_type> componentOf;
+    if (auto *ilGraph = dynamic_cast<IncidenceListGraph*>(diGraph)) {
+        numComponents = computeComponents(ilGraph, componentOf);
+        if (computePropertyValues) {
+            for (DiGraph::size_type i = 0U; i < componentOf.size(); i++) {
+                property->setValue(ilGraph->vertexAt(i), componentOf[i]);
+            }
+        }
+    } else if (auto *staticGraph = dynamic_cast<StaticDiGraph*>(diGraph)) {
+        numComponents = computeComponents(staticGraph, componentOf);
+        if (computePropertyValues) {
+            for (DiGraph::size_type i = 0U; i < componentOf.size(); i++) {
+                property->setValue(staticGraph->vertexAt(i), componentOf[i]);
+            }
+        }
+    } else {
+        FastPropertyMap<GraphArtifact*> original(nullptr);
+        StaticDiGraph snapshot;
+        snapshot.assign(diGraph, nullptr, nullptr, &original);
+        numComponents = computeComponents(&snapshot, componentOf);
+        if (computePropertyValues) {
+            for (DiGraph::size_type i = 0U; i < componentOf.size(); i++) {
+                property->setValue(original(snapshot.vertexAt(i)), componentOf[i]);
+            }
+        }
+    }
+}
+
+}
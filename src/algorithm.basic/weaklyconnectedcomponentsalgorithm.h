@@ -0,0 +1,81 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef WEAKLYCONNECTEDCOMPONENTSALGORITHM_H
+#define WEAKLYCONNECTEDCOMPONENTSALGORITHM_H
+
+#include "algorithm/propertycomputingalgorithm.h"
+#include "graph/digraph.h"
+
+#include <memory>
+
+namespace Algora {
+
+class ThreadPool;
+
+/**
+ * Weakly connected components with a concurrent union-find, following
+ * Afforest (Sutton et al.): every vertex is first linked along a few of its
+ * arcs, then the largest intermediate component is estimated by sampling,
+ * and only the arcs of vertices outside of it are processed further.
+ * Vertices are processed in parallel chunks.
+ * Components are numbered 0, 1, ... in the order of their first vertex.
+ */
+class WeaklyConnectedComponentsAlgorithm
+        : public PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>
+{
+public:
+    explicit WeaklyConnectedComponentsAlgorithm(bool computeValues = true);
+    virtual ~WeaklyConnectedComponentsAlgorithm() override;
+
+    // 0 uses all hardware threads
+    void setNumThreads(unsigned n);
+    // use an external pool instead of an own one; nullptr reverts to an own pool
+    void useThreadPool(ThreadPool *threadPool) { pool = threadPool; }
+    // graphs with fewer vertices are processed by the calling thread alone
+    void setSequentialThreshold(DiGraph::size_type t) { sequentialThreshold = t; }
+
+    // DiGraphAlgorithm interface
+public:
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Weakly Connected Components"; }
+    virtual std::string getShortName() const noexcept override { return "wcc"; }
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual DiGraph::size_type deliver() override { return numComponents; }
+
+private:
+    DiGraph::size_type numComponents;
+    unsigned numThreads;
+    ThreadPool *pool;
+    std::unique_ptr<ThreadPool> ownPool;
+    DiGraph::size_type sequentialThreshold;
+
+    ThreadPool &threadPool();
+    template<typename GraphType>
+    DiGraph::size_type computeComponents(GraphType *graph, std::vector<DiGraph::size_type> &componentOf);
+};
+
+}
+
+#endif // WEAKLYCONNECTEDCOMPONENTSALGORITHM_H
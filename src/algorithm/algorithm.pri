@@ -26,6 +26,7 @@ HEADERS += \
     $$PWD/digraphalgorithm.h \
     $$PWD/valuecomputingalgorithm.h \
     $$PWD/propertycomputingalgorithm.h \
-    $$PWD/digraphalgorithmexception.h
+    $$PWD/digraphalgorithmexception.h \
+    $$PWD/digraphdispatch.h
 
 SOURCES +=       
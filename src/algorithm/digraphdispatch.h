@@ -0,0 +1,68 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef DIGRAPHDISPATCH_H
+#define DIGRAPHDISPATCH_H
+
+#include "graph/digraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "graph.static/staticdigraph.h"
+
+namespace Algora {
+
+// Calls f with the graph cast to its concrete type if that type offers
+// inlined iteration (forEachOutgoing/forEachIncoming), and as DiGraph otherwise.
+template<typename F>
+auto dispatchDiGraph(DiGraph *graph, F &&f)
+{
+    if (auto *ilGraph = dynamic_cast<IncidenceListGraph*>(graph)) {
+        return f(ilGraph);
+    }
+    if (auto *staticGraph = dynamic_cast<StaticDiGraph*>(graph)) {
+        return f(staticGraph);
+    }
+    return f(graph);
+}
+
+// Whether the vertex ids of graph are unique and bounded by its capacity,
+// so that id-indexed maps such as FastPropertyMap may be used safely.
+inline bool hasCompactVertexIds(const DiGraph *graph)
+{
+    return dynamic_cast<const IncidenceListGraph*>(graph)
+            || dynamic_cast<const StaticDiGraph*>(graph);
+}
+
+// Index of v in [0, graph->getSize()) for graphs that maintain dense vertex
+// indices; vertexAt() is the inverse. v must belong to graph.
+inline DiGraph::size_type vertexIndexOf(const IncidenceListGraph *, const Vertex *v)
+{
+    return static_cast<const IncidenceListVertex*>(v)->getIndex();
+}
+
+inline DiGraph::size_type vertexIndexOf(const StaticDiGraph *, const Vertex *v)
+{
+    return v->getId();
+}
+
+}
+
+#endif // DIGRAPHDISPATCH_H
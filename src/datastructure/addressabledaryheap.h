@@ -0,0 +1,171 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef ADDRESSABLEDARYHEAP_H
+#define ADDRESSABLEDARYHEAP_H
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace Algora {
+
+/**
+ * Addressable d-ary min-heap over the keys 0, ..., capacity - 1.
+ * Every key is contained at most once; its priority can be decreased in place.
+ */
+template<typename Priority, unsigned Arity = 4U, typename Compare = std::less<Priority>>
+class AddressableDAryHeap
+{
+    static_assert(Arity >= 2U, "A heap needs an arity of at least two.");
+
+public:
+    typedef typename std::vector<Priority>::size_type size_type;
+    typedef size_type key_type;
+
+    explicit AddressableDAryHeap(size_type capacity = 0U, const Compare &compare = Compare())
+        : positions(capacity, NOT_CONTAINED), compare(compare) { }
+
+    // allows keys up to capacity - 1
+    void reserveKeys(size_type capacity) {
+        if (positions.size() < capacity) {
+            positions.resize(capacity, NOT_CONTAINED);
+        }
+    }
+    size_type getCapacity() const { return positions.size(); }
+
+    bool empty() const { return heap.empty(); }
+    size_type size() const { return heap.size(); }
+    bool contains(key_type key) const { return positions[key] != NOT_CONTAINED; }
+
+    key_type top() const { return heap.front().key; }
+    const Priority &topPriority() const { return heap.front().priority; }
+    const Priority &priority(key_type key) const { return heap[positions[key]].priority; }
+
+    // key must not be contained
+    void push(key_type key, const Priority &p) {
+        positions[key] = heap.size();
+        heap.push_back(Entry { p, key });
+        siftUp(heap.size() - 1U);
+    }
+
+    // key must be contained, and p must not be worse than its current priority
+    void decrease(key_type key, const Priority &p) {
+        auto pos = positions[key];
+        heap[pos].priority = p;
+        siftUp(pos);
+    }
+
+    // inserts key or decreases its priority; returns false if neither applied
+    bool pushOrDecrease(key_type key, const Priority &p) {
+        if (!contains(key)) {
+            push(key, p);
+            return true;
+        }
+        if (compare(p, heap[positions[key]].priority)) {
+            decrease(key, p);
+            return true;
+        }
+        return false;
+    }
+
+    void pop() {
+        positions[heap.front().key] = NOT_CONTAINED;
+        if (heap.size() > 1U) {
+            heap.front() = heap.back();
+            positions[heap.front().key] = 0U;
+            heap.pop_back();
+            siftDown(0U);
+        } else {
+            heap.pop_back();
+        }
+    }
+
+    // runs in the number of contained keys
+    void clear() {
+        for (const auto &e : heap) {
+            positions[e.key] = NOT_CONTAINED;
+        }
+        heap.clear();
+    }
+
+private:
+    struct Entry {
+        Priority priority;
+        key_type key;
+    };
+
+    static constexpr size_type NOT_CONTAINED = std::numeric_limits<size_type>::max();
+
+    std::vector<Entry> heap;
+    std::vector<size_type> positions;
+    Compare compare;
+
+    void siftUp(size_type pos) {
+        Entry e = heap[pos];
+        while (pos > 0U) {
+            auto parent = (pos - 1U) / Arity;
+            if (!compare(e.priority, heap[parent].priority)) {
+                break;
+            }
+            heap[pos] = heap[parent];
+            positions[heap[pos].key] = pos;
+            pos = parent;
+        }
+        heap[pos] = e;
+        positions[e.key] = pos;
+    }
+
+    void siftDown(size_type pos) {
+        Entry e = heap[pos];
+        auto n = heap.size();
+        while (true) {
+            auto first = pos * Arity + 1U;
+            if (first >= n) {
+                break;
+            }
+            auto last = first + Arity < n ? first + Arity : n;
+            auto best = first;
+            for (auto c = first + 1U; c < last; c++) {
+                if (compare(heap[c].priority, heap[best].priority)) {
+                    best = c;
+                }
+            }
+            if (!compare(heap[best].priority, e.priority)) {
+                break;
+            }
+            heap[pos] = heap[best];
+            positions[heap[pos].key] = pos;
+            pos = best;
+        }
+        heap[pos] = e;
+        positions[e.key] = pos;
+    }
+};
+
+template<typename Priority, unsigned Arity, typename Compare>
+constexpr typename AddressableDAryHeap<Priority, Arity, Compare>::size_type
+AddressableDAryHeap<Priority, Arity, Compare>::NOT_CONTAINED;
+
+}
+
+#endif // ADDRESSABLEDARYHEAP_H
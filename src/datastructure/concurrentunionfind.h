@@ -0,0 +1,122 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef CONCURRENTUNIONFIND_H
+#define CONCURRENTUNIONFIND_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Algora {
+
+/**
+ * Lock-free disjoint sets over the elements 0, ..., size() - 1.
+ * find() and unite() may be called concurrently. Roots are linked by
+ * index, the larger below the smaller, so that the root of a set is its
+ * minimum element once all unions have completed; paths are halved with
+ * compare-and-swap.
+ */
+class ConcurrentUnionFind
+{
+public:
+    typedef std::size_t size_type;
+
+    explicit ConcurrentUnionFind(size_type n = 0U) : n(0U) { reset(n); }
+
+    ConcurrentUnionFind(const ConcurrentUnionFind &other) = delete;
+    ConcurrentUnionFind &operator=(const ConcurrentUnionFind &other) = delete;
+
+    // n singleton sets; not thread-safe
+    void reset(size_type size) {
+        if (size != n) {
+            parent.reset(new std::atomic<size_type>[size]);
+            n = size;
+        }
+        for (size_type i = 0U; i < n; i++) {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    size_type size() const { return n; }
+
+    size_type find(size_type x) {
+        while (true) {
+            auto p = parent[x].load(std::memory_order_relaxed);
+            if (p == x) {
+                return x;
+            }
+            auto gp = parent[p].load(std::memory_order_relaxed);
+            if (p != gp) {
+                parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+            }
+            x = gp;
+        }
+    }
+
+    bool sameSet(size_type x, size_type y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) {
+                return true;
+            }
+            // x is still a root, so the sets have not been united in the meantime
+            if (parent[x].load(std::memory_order_relaxed) == x) {
+                return false;
+            }
+        }
+    }
+
+    // returns false if x and y have already been in the same set
+    bool unite(size_type x, size_type y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) {
+                return false;
+            }
+            if (x < y) {
+                std::swap(x, y);
+            }
+            // link the larger root below the smaller one
+            size_type expected = x;
+            if (parent[x].compare_exchange_strong(expected, y, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+    }
+
+    // direct parent; equals x iff x is a root
+    size_type parentOf(size_type x) const {
+        return parent[x].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<std::atomic<size_type>[]> parent;
+    size_type n;
+};
+
+}
+
+#endif // CONCURRENTUNIONFIND_H
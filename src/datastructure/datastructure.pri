@@ -23,8 +23,11 @@
 message("pri file being processed: $$PWD")
 
 HEADERS += \
+    $$PWD/addressabledaryheap.h \
     $$PWD/bucketqueue.h \
     $$PWD/circularbucketlist.h \
-    $$PWD/fastvertexset.h
+    $$PWD/concurrentunionfind.h \
+    $$PWD/fastvertexset.h \
+    $$PWD/unionfind.h
 
 SOURCES +=
@@ -25,6 +25,7 @@
 
 #include "graph/vertex.h"
 #include "property/fastpropertymap.h"
+#include "property/fastbitpropertymap.h"
 
 #include <vector>
 
@@ -42,35 +43,47 @@ public:
         setIndex.setDefaultValue(0U);
         if (capacity > 0U) {
             setIndex.resetAll(capacity);
+            members.resetAll(capacity);
         }
     }
 
-    bool contains(const Vertex *v) {
-        return setIndex(v) > 0U;
+    bool contains(const Vertex *v) const {
+        return members(v);
     }
 
     void add(Vertex *v) {
-        if (setIndex(v) > 0U) {
+        if (members(v)) {
             return;
         }
         set.push_back(v);
         setIndex[v] = set.size();
+        members.setValue(v, true);
     }
 
     void remove(Vertex *v) {
-        if (setIndex(v) == 0U) {
+        if (!members(v)) {
             return;
         }
         auto index = setIndex(v) - 1U;
         set[index] = set.back();
         set.pop_back();
-        setIndex[set[index]] = index + 1U;
+        if (index < set.size()) {
+            setIndex[set[index]] = index + 1U;
+        }
         setIndex.resetToDefault(v);
+        members.resetToDefault(v);
     }
 
     void clear() {
+        for (auto v : set) {
+            setIndex.resetToDefault(v);
+        }
         set.clear();
-        setIndex.resetAll();
+        members.resetAll();
+    }
+
+    const FastBitPropertyMap &getMembers() const {
+        return members;
     }
 
     size_type getSize() const {
@@ -88,6 +101,7 @@ public:
 private:
     std::vector<Vertex*> set;
     FastPropertyMap<size_type> setIndex;
+    FastBitPropertyMap members;
 };
 
 }
@@ -0,0 +1,101 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+
+#include <vector>
+
+namespace Algora {
+
+/**
+ * Disjoint sets over the elements 0, ..., size() - 1,
+ * with union by rank and path halving.
+ */
+class UnionFind
+{
+public:
+    typedef std::vector<unsigned>::size_type size_type;
+
+    explicit UnionFind(size_type n = 0U) { reset(n); }
+
+    // n singleton sets
+    void reset(size_type n) {
+        parent.resize(n);
+        for (size_type i = 0U; i < n; i++) {
+            parent[i] = i;
+        }
+        rank.assign(n, 0U);
+        numSets = n;
+    }
+
+    // adds a singleton set and returns its element
+    size_type add() {
+        parent.push_back(parent.size());
+        rank.push_back(0U);
+        numSets++;
+        return parent.size() - 1U;
+    }
+
+    size_type size() const { return parent.size(); }
+    size_type getNumSets() const { return numSets; }
+
+    size_type find(size_type x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    bool sameSet(size_type x, size_type y) {
+        return find(x) == find(y);
+    }
+
+    // returns false if x and y have already been in the same set
+    bool unite(size_type x, size_type y) {
+        x = find(x);
+        y = find(y);
+        if (x == y) {
+            return false;
+        }
+        if (rank[x] < rank[y]) {
+            parent[x] = y;
+        } else {
+            parent[y] = x;
+            if (rank[x] == rank[y]) {
+                rank[x]++;
+            }
+        }
+        numSets--;
+        return true;
+    }
+
+private:
+    std::vector<size_type> parent;
+    std::vector<unsigned> rank;
+    size_type numSets;
+};
+
+}
+
+#endif // UNIONFIND_H
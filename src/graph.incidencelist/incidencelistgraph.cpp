@@ -28,6 +28,7 @@
 
 #include "incidencelistgraphimplementation.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 //#define DEBUG_ILDIGRAPH
@@ -107,21 +108,49 @@ Vertex *IncidenceListGraph::addVertex()
     return v;
 }
 
+void IncidenceListGraph::addVertices(size_type n, std::vector<Vertex *> *added)
+{
+    impl->reserveVertexCapacity(impl->getSize() + n);
+
+    std::vector<Vertex*> greetings;
+    if (!added && observableVertexGreetings.hasObservers()) {
+        added = &greetings;
+    }
+    size_type first = 0U;
+    if (added) {
+        first = added->size();
+        added->reserve(first + n);
+    }
+    for (size_type i = 0; i < n; i++) {
+        auto v = recycleOrCreateIncidenceListVertex();
+        impl->addVertex(v);
+        if (added) {
+            added->push_back(v);
+        }
+    }
+    if (added) {
+        greetVertices(added->data() + first, n);
+    }
+}
+
 void IncidenceListGraph::removeVertex(Vertex *v)
 {
     auto vertex = castVertex(v, this);
 
-    impl->mapOutgoingArcs(vertex, [&](Arc *a) {
-        invalidateArc(a);
-        dismissArc(a);
-    }, arcFalse);
-    impl->mapIncomingArcs(vertex, [&](Arc *a) {
-        invalidateArc(a);
-        dismissArc(a);
-    }, arcFalse);
+    {
+        FarewellBatch farewells(this);
+        impl->mapOutgoingArcs(vertex, [&](Arc *a) {
+            invalidateArc(a);
+            dismissArc(a);
+        }, arcFalse);
+        impl->mapIncomingArcs(vertex, [&](Arc *a) {
+            invalidateArc(a);
+            dismissArc(a);
+        }, arcFalse);
 
-    invalidateVertex(vertex);
-    dismissVertex(vertex);
+        invalidateVertex(vertex);
+        dismissVertex(vertex);
+    }
 
     impl->removeVertex(vertex);
 }
@@ -154,6 +183,11 @@ IncidenceListVertex *IncidenceListGraph::vertexAt(size_type i) const
     return impl->vertexAt(i);
 }
 
+const IncidenceListVertex *IncidenceListGraph::checkedVertex(const Vertex *v) const
+{
+    return castVertex(v, this);
+}
+
 void IncidenceListGraph::mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition)
 {
     impl->mapVertices(vvFun, breakCondition);
@@ -171,6 +205,54 @@ Arc *IncidenceListGraph::addArc(Vertex *tail, Vertex *head)
     return a;
 }
 
+void IncidenceListGraph::addArcs(const ArcEndpoints *arcs, size_type num, std::vector<Arc *> *added)
+{
+    // validate all endpoints before modifying anything and count degrees
+    // of the endpoints in this batch only
+    std::vector<IncidenceListVertex*> tails(num);
+    std::vector<IncidenceListVertex*> heads(num);
+    for (size_type i = 0; i < num; i++) {
+        tails[i] = castVertex(arcs[i].first, this);
+        heads[i] = castVertex(arcs[i].second, this);
+    }
+    auto byIndex = [](const IncidenceListVertex *l, const IncidenceListVertex *r) {
+        return l->getIndex() < r->getIndex();
+    };
+    std::sort(tails.begin(), tails.end(), byIndex);
+    std::sort(heads.begin(), heads.end(), byIndex);
+    for (size_type i = 0, j = 0; i < num; i = j) {
+        for (j = i + 1; j < num && tails[j] == tails[i]; j++) { }
+        tails[i]->reserveOutgoingSimpleArcs(j - i);
+    }
+    for (size_type i = 0, j = 0; i < num; i = j) {
+        for (j = i + 1; j < num && heads[j] == heads[i]; j++) { }
+        heads[i]->reserveIncomingSimpleArcs(j - i);
+    }
+    impl->reserveArcCapacity(impl->getNumArcs(true) + num);
+
+    std::vector<Arc*> greetings;
+    if (!added && observableArcGreetings.hasObservers()) {
+        added = &greetings;
+    }
+    size_type first = 0U;
+    if (added) {
+        first = added->size();
+        added->reserve(first + num);
+    }
+    for (size_type i = 0; i < num; i++) {
+        auto t = static_cast<IncidenceListVertex*>(arcs[i].first);
+        auto h = static_cast<IncidenceListVertex*>(arcs[i].second);
+        Arc *a = recycleOrCreateArc(t, h);
+        impl->addSimpleArc(a, t, h);
+        if (added) {
+            added->push_back(a);
+        }
+    }
+    if (added) {
+        greetArcs(added->data() + first, num);
+    }
+}
+
 MultiArc *IncidenceListGraph::addMultiArc(Vertex *tail, Vertex *head, size_type size)
 {
     if (size <= 0) {
@@ -195,6 +277,7 @@ void IncidenceListGraph::removeArc(Arc *a)
     auto tail = castVertex(a->getTail(), this);
     auto head = castVertex(a->getHead(), this);
 
+    flushPendingGreetings();
     invalidateArc(a);
     dismissArc(a);
     impl->removeArc(a, tail, head);
@@ -283,14 +366,17 @@ Graph::size_type IncidenceListGraph::getSize() const
 
 void IncidenceListGraph::clear()
 {
-    impl->mapArcs([this](Arc *a) {
-        invalidateArc(a);
-        dismissArc(a);
-    }, arcFalse);
-    impl->mapVertices([this](Vertex *v) {
-        invalidateVertex(v);
-        dismissVertex(v);
-    }, vertexFalse);
+    {
+        FarewellBatch farewells(this);
+        impl->mapArcs([this](Arc *a) {
+            invalidateArc(a);
+            dismissArc(a);
+        }, arcFalse);
+        impl->mapVertices([this](Vertex *v) {
+            invalidateVertex(v);
+            dismissVertex(v);
+        }, vertexFalse);
+    }
    impl->clear(false);
    DiGraph::clear();
 }
@@ -299,15 +385,18 @@ void IncidenceListGraph::clearAndRelease()
 {
     PRINT_DEBUG("CR: Clear&Release...")
     PRINT_DEBUG("CR: Invalidating and dismissing arcs...")
-    impl->mapArcs([this](Arc *a) {
-        invalidateArc(a);
-        dismissArc(a);
-    }, arcFalse);
-    PRINT_DEBUG("CR: Invalidating and dismissing vertices...")
-    impl->mapVertices([this](Vertex *v) {
-        invalidateVertex(v);
-        dismissVertex(v);
-    }, vertexFalse);
+    {
+        FarewellBatch farewells(this);
+        impl->mapArcs([this](Arc *a) {
+            invalidateArc(a);
+            dismissArc(a);
+        }, arcFalse);
+        PRINT_DEBUG("CR: Invalidating and dismissing vertices...")
+        impl->mapVertices([this](Vertex *v) {
+            invalidateVertex(v);
+            dismissVertex(v);
+        }, vertexFalse);
+    }
     PRINT_DEBUG("CR: Clearing internal stuff...")
     impl->clear(true);
     DiGraph::clear();
@@ -316,14 +405,17 @@ void IncidenceListGraph::clearAndRelease()
 
 void IncidenceListGraph::clearOrderedly()
 {
-    impl->mapArcs([this](Arc *a) {
-        invalidateArc(a);
-        dismissArc(a);
-    }, arcFalse);
-    impl->mapVertices([this](Vertex *v) {
-        invalidateVertex(v);
-        dismissVertex(v);
-    }, vertexFalse);
+    {
+        FarewellBatch farewells(this);
+        impl->mapArcs([this](Arc *a) {
+            invalidateArc(a);
+            dismissArc(a);
+        }, arcFalse);
+        impl->mapVertices([this](Vertex *v) {
+            invalidateVertex(v);
+            dismissVertex(v);
+        }, vertexFalse);
+    }
    impl->clear(false, true);
    DiGraph::clear();
 }
@@ -377,6 +469,7 @@ void IncidenceListGraph::activateVertex(Vertex *v, bool activateIncidentArcs)
     if (!impl->activateVertex(vertex, activateIncidentArcs)) {
         throw std::invalid_argument("Vertex activation failed.");
     }
+    UpdateBatch batch(this);
     greetVertex(v);
     if (activateIncidentArcs) {
         vertex->mapOutgoingArcs([this](Arc *a) {
@@ -391,17 +484,20 @@ void IncidenceListGraph::activateVertex(Vertex *v, bool activateIncidentArcs)
 void IncidenceListGraph::deactivateVertex(Vertex *v)
 {
     auto vertex = castVertex(v, this);
-    impl->mapOutgoingArcs(vertex, [&](Arc *a) {
-        invalidateArc(a);
-        dismissArc(a);
-    }, arcFalse);
-    impl->mapIncomingArcs(vertex, [&](Arc *a) {
-        invalidateArc(a);
-        dismissArc(a);
-    }, arcFalse);
+    {
+        FarewellBatch farewells(this);
+        impl->mapOutgoingArcs(vertex, [&](Arc *a) {
+            invalidateArc(a);
+            dismissArc(a);
+        }, arcFalse);
+        impl->mapIncomingArcs(vertex, [&](Arc *a) {
+            invalidateArc(a);
+            dismissArc(a);
+        }, arcFalse);
 
-    invalidateVertex(vertex);
-    dismissVertex(vertex);
+        invalidateVertex(vertex);
+        dismissVertex(vertex);
+    }
 
     if (!impl->deactivateVertex(vertex)) {
         throw std::invalid_argument("Vertex deactivation failed.");
@@ -431,6 +527,7 @@ void IncidenceListGraph::deactivateArc(Arc *a)
     auto tail = castVertex(a->getTail(), this);
     auto head = castVertex(a->getHead(), this);
 
+    flushPendingGreetings();
     invalidateArc(a);
     dismissArc(a);
 
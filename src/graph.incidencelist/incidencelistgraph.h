@@ -24,10 +24,10 @@
 #define INCIDENCELISTGRAPH_H
 
 #include "graph/digraph.h"
+#include "incidencelistvertex.h"
 
 namespace Algora {
 
-class IncidenceListVertex;
 class IncidenceListGraphImplementation;
 template<typename T>
 class ModifiableProperty;
@@ -63,6 +63,7 @@ public:
     virtual void removeVertex(Vertex *v) override;
     virtual bool containsVertex(const Vertex *v) const override;
     virtual Vertex *getAnyVertex() const override;
+    virtual void addVertices(size_type n, std::vector<Vertex*> *added = nullptr) override;
     virtual IncidenceListVertex *vertexAt(size_type i) const;
 
     virtual void mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition) override;
@@ -82,6 +83,8 @@ public:
     virtual void removeArc(Arc *a) override;
     virtual bool containsArc(const Arc *a) const override;
     virtual Arc *findArc(const Vertex *from, const Vertex *to) const override;
+    using DiGraph::addArcs;
+    virtual void addArcs(const ArcEndpoints *arcs, size_type num, std::vector<Arc*> *added = nullptr) override;
     virtual size_type getNumArcs(bool multiArcsAsSimple) const override;
 
     virtual size_type getOutDegree(const Vertex *v, bool multiArcsAsSimple) const override;
@@ -93,6 +96,17 @@ public:
     virtual void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
     virtual void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
 
+    // inlined iteration, see IncidenceListVertex::forEachOutgoing()
+    template<typename F>
+    bool forEachOutgoing(const Vertex *v, F &&f) const {
+        return checkedVertex(v)->forEachOutgoing(f);
+    }
+    template<typename F>
+    bool forEachIncoming(const Vertex *v, F &&f) const {
+        return checkedVertex(v)->forEachIncoming(f);
+    }
+    const IncidenceListVertex *checkedVertex(const Vertex *v) const;
+
 public:
     void bundleParallelArcs();
     void unbundleParallelArcs();
@@ -159,12 +159,13 @@ void IncidenceListGraphImplementation::clear(bool emptyReserves, bool restoreOrd
     vertices.clear();
     deactivatedVertices.clear();
     numArcs = 0U;
-    nextVertexId = 0U;
-    nextArcId = 0U;
     recycledVertexIds.clear();
     recycledArcIds.clear();
 
     if (emptyReserves) {
+        // pooled vertices and arcs keep their ids
+        nextVertexId = 0U;
+        nextArcId = 0U;
         PRINT_DEBUG("C: Destroying arc pool of size " << arcPool.size() << "...")
         delete arcStorage;
         arcStorage = new boost::object_pool<Arc>;
@@ -402,10 +403,12 @@ void IncidenceListGraphImplementation::reserveVertexCapacity(size_type n)
     if (n <= vertices.size() + vertexPool.size()) {
         return;
     }
-    auto reserve = n - getSize();
+    auto reserve = n - vertices.size() - vertexPool.size();
 
-    vertexPool.reserve(n);
-    vertexStorage->set_next_size(reserve);
+    // as for arcs, keep repeated small reservations geometric
+    if (reserve > vertexStorage->get_next_size()) {
+        vertexStorage->set_next_size(reserve);
+    }
 
     std::vector<IncidenceListVertex*> tmp;
     tmp.reserve(reserve);
@@ -415,7 +418,9 @@ void IncidenceListGraphImplementation::reserveVertexCapacity(size_type n)
         tmp.push_back(v);
     }
     vertexPool.insert(vertexPool.end(), tmp.rbegin(), tmp.rend());
-    vertices.reserve(getSize() + reserve);
+    if (n > vertices.capacity()) {
+        vertices.reserve(std::max(n, 2 * vertices.capacity()));
+    }
 }
 
 void IncidenceListGraphImplementation::reserveArcCapacity(size_type n)
@@ -425,15 +430,19 @@ void IncidenceListGraphImplementation::reserveArcCapacity(size_type n)
         PRINT_DEBUG("RAC: Requested capacity does not exceed current capacity. Nothing to do.")
         return;
     }
-    auto reserve = n - numArcs;
+    auto reserve = n - numArcs - arcPool.size();
     PRINT_DEBUG("RAC: Need " << reserve << " additional capacity.")
 
     if (reserve == 0U) {
         return;
     }
 
-    arcPool.reserve(n);
-    arcStorage->set_next_size(reserve);
+    // arcPool only holds unused arcs; let it grow geometrically on insertion,
+    // and never shrink the doubling block size of arcStorage, as many small
+    // blocks make allocation from the ordered pool slow
+    if (reserve > arcStorage->get_next_size()) {
+        arcStorage->set_next_size(reserve);
+    }
 
     PRINT_DEBUG("RAC: Creating and hibernating " << reserve << " arcs...")
     std::vector<Arc*> tmp;
@@ -198,6 +198,15 @@ void IncidenceListVertex::clearOutgoingArcs()
     grin->deactivatedOutgoingMultiArcs.clear();
 }
 
+void IncidenceListVertex::reserveOutgoingSimpleArcs(size_type n)
+{
+    auto &arcs = grin->outgoingArcs;
+    if (arcs.size() + n > arcs.capacity()) {
+        // keep the growth geometric for repeated small reservations
+        arcs.reserve(std::max(arcs.size() + n, 2 * arcs.capacity()));
+    }
+}
+
 IncidenceListVertex::size_type IncidenceListVertex::getInDegree(bool multiArcsAsSimple) const
 {
     auto deg = grin->incomingArcs.size();
@@ -289,6 +298,15 @@ void IncidenceListVertex::clearIncomingArcs()
     grin->deactivatedIncomingMultiArcs.clear();
 }
 
+void IncidenceListVertex::reserveIncomingSimpleArcs(size_type n)
+{
+    auto &arcs = grin->incomingArcs;
+    if (arcs.size() + n > arcs.capacity()) {
+        // keep the growth geometric for repeated small reservations
+        arcs.reserve(std::max(arcs.size() + n, 2 * arcs.capacity()));
+    }
+}
+
 void IncidenceListVertex::enableConsistencyCheck(bool enable)
 {
     grin->checkConsisteny = enable;
@@ -299,6 +317,26 @@ IncidenceListVertex::size_type IncidenceListVertex::getIndex() const
     return grin->index;
 }
 
+const std::vector<Arc *> &IncidenceListVertex::getOutgoingSimpleArcs() const
+{
+    return grin->outgoingArcs;
+}
+
+const std::vector<MultiArc *> &IncidenceListVertex::getOutgoingMultiArcs() const
+{
+    return grin->outgoingMultiArcs;
+}
+
+const std::vector<Arc *> &IncidenceListVertex::getIncomingSimpleArcs() const
+{
+    return grin->incomingArcs;
+}
+
+const std::vector<MultiArc *> &IncidenceListVertex::getIncomingMultiArcs() const
+{
+    return grin->incomingMultiArcs;
+}
+
 bool IncidenceListVertex::activateOutgoingArc(Arc *a)
 {
     if (removeArcFromList(grin->deactivatedOutgoingArcs, grin->outIndex, a)) {
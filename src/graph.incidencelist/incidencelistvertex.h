@@ -24,8 +24,11 @@
 #define INCIDENCELISTVERTEX_H
 
 #include "graph/vertex.h"
+#include "graph/multiarc.h"
 #include "graph/graph_functional.h"
 
+#include <vector>
+
 namespace Algora {
 
 class IncidenceListGraph;
@@ -76,6 +79,23 @@ public:
 
     size_type getIndex() const;
 
+    // plain access to the active arc lists
+    const std::vector<Arc*> &getOutgoingSimpleArcs() const;
+    const std::vector<MultiArc*> &getOutgoingMultiArcs() const;
+    const std::vector<Arc*> &getIncomingSimpleArcs() const;
+    const std::vector<MultiArc*> &getIncomingMultiArcs() const;
+
+    // inlined iteration over valid arcs; f may return false to stop early.
+    // Returns true iff all arcs have been visited.
+    template<typename F>
+    bool forEachOutgoing(F &&f) const {
+        return forEachArc(getOutgoingSimpleArcs(), getOutgoingMultiArcs(), f);
+    }
+    template<typename F>
+    bool forEachIncoming(F &&f) const {
+        return forEachArc(getIncomingSimpleArcs(), getIncomingMultiArcs(), f);
+    }
+
     // (de)activation of arcs
     bool activateOutgoingArc(Arc *a);
     bool activateIncomingArc(Arc *a);
@@ -97,6 +117,7 @@ protected:
     virtual void addOutgoingSimpleArc(Arc *ma);
     virtual bool removeOutgoingArc(const Arc *a);
     virtual void clearOutgoingArcs();
+    void reserveOutgoingSimpleArcs(size_type n);
 
     [[deprecated("use addIncomingSimpleArc() or addIncomingMultiArc() instead")]]
     virtual void addIncomingArc(Arc *a);
@@ -104,6 +125,7 @@ protected:
     virtual void addIncomingSimpleArc(Arc *a);
     virtual bool removeIncomingArc(const Arc *a);
     virtual void clearIncomingArcs();
+    void reserveIncomingSimpleArcs(size_type n);
 
     virtual void enableConsistencyCheck(bool enable);
 
@@ -115,6 +137,21 @@ protected:
 private:
     class CheshireCat;
     CheshireCat *grin;
+
+    template<typename F>
+    static bool forEachArc(const std::vector<Arc*> &arcs, const std::vector<MultiArc*> &multiArcs, F &f) {
+        for (Arc *a : arcs) {
+            if (a->isValid() && !invokeAndContinue(f, a)) {
+                return false;
+            }
+        }
+        for (MultiArc *a : multiArcs) {
+            if (a->isValid() && !invokeAndContinue(f, static_cast<Arc*>(a))) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 }
@@ -0,0 +1,492 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "staticdigraph.h"
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "graph.incidencelist/incidencelistvertex.h"
+#include "property/propertymap.h"
+
+#include <stdexcept>
+#include <sstream>
+
+namespace Algora {
+
+StaticDiGraph::StaticDiGraph(GraphArtifact *parent)
+    : DiGraph(parent), outOffsets(1, 0U), inOffsets(1, 0U), numArcsWithSize(0U)
+{
+}
+
+StaticDiGraph::StaticDiGraph(DiGraph *graph,
+                             ModifiableProperty<GraphArtifact *> *otherToThisVertices,
+                             ModifiableProperty<GraphArtifact *> *otherToThisArcs,
+                             ModifiableProperty<GraphArtifact *> *thisToOtherVertices,
+                             ModifiableProperty<GraphArtifact *> *thisToOtherArcs)
+    : DiGraph(graph->getParent()), outOffsets(1, 0U), inOffsets(1, 0U), numArcsWithSize(0U)
+{
+    assign(graph, otherToThisVertices, otherToThisArcs, thisToOtherVertices, thisToOtherArcs);
+}
+
+StaticDiGraph::~StaticDiGraph()
+{
+    release();
+}
+
+StaticDiGraph::StaticDiGraph(StaticDiGraph &&other)
+    : DiGraph(std::move(other)),
+      vertices(std::move(other.vertices)), simpleArcs(std::move(other.simpleArcs)),
+      multiArcs(std::move(other.multiArcs)),
+      outOffsets(std::move(other.outOffsets)), outHeads(std::move(other.outHeads)),
+      outArcs(std::move(other.outArcs)),
+      inOffsets(std::move(other.inOffsets)), inTails(std::move(other.inTails)),
+      inArcs(std::move(other.inArcs)),
+      numArcsWithSize(other.numArcsWithSize)
+{
+    other.multiArcs.clear();
+    other.release();
+    adopt();
+}
+
+StaticDiGraph &StaticDiGraph::operator=(StaticDiGraph &&other)
+{
+    if (&other == this) {
+        return *this;
+    }
+    release();
+    DiGraph::operator=(std::move(other));
+    vertices = std::move(other.vertices);
+    simpleArcs = std::move(other.simpleArcs);
+    multiArcs = std::move(other.multiArcs);
+    outOffsets = std::move(other.outOffsets);
+    outHeads = std::move(other.outHeads);
+    outArcs = std::move(other.outArcs);
+    inOffsets = std::move(other.inOffsets);
+    inTails = std::move(other.inTails);
+    inArcs = std::move(other.inArcs);
+    numArcsWithSize = other.numArcsWithSize;
+
+    other.multiArcs.clear();
+    other.release();
+    adopt();
+    return *this;
+}
+
+StaticDiGraph &StaticDiGraph::assign(DiGraph *graph,
+                                     ModifiableProperty<GraphArtifact *> *otherToThisVertices,
+                                     ModifiableProperty<GraphArtifact *> *otherToThisArcs,
+                                     ModifiableProperty<GraphArtifact *> *thisToOtherVertices,
+                                     ModifiableProperty<GraphArtifact *> *thisToOtherArcs)
+{
+    if (graph == this) {
+        return *this;
+    }
+    release();
+
+    const size_type n = graph->getSize();
+    std::vector<Vertex*> otherVertices;
+    otherVertices.reserve(n);
+    vertices.reserve(n);
+
+    auto *ilGraph = dynamic_cast<IncidenceListGraph*>(graph);
+    PropertyMap<size_type> otherIndex(0U);
+    graph->mapVertices([&](Vertex *v) {
+        size_type i = vertices.size();
+        vertices.emplace_back(i, this);
+        otherVertices.push_back(v);
+        if (!ilGraph) {
+            otherIndex[v] = i;
+        }
+        Vertex *tv = &vertices.back();
+        tv->setName(v->getName());
+        if (otherToThisVertices) {
+            (*otherToThisVertices)[v] = tv;
+        }
+        if (thisToOtherVertices) {
+            (*thisToOtherVertices)[tv] = v;
+        }
+    });
+    auto indexOfOther = [&](const Vertex *v) {
+        return ilGraph ? static_cast<const IncidenceListVertex*>(v)->getIndex()
+                       : otherIndex(v);
+    };
+
+    std::vector<Arc*> otherArcs;
+    otherArcs.reserve(graph->getNumArcs(true));
+    outOffsets.resize(n + 1);
+    inOffsets.assign(n + 1, 0U);
+    size_type numSimpleArcs = 0U;
+    for (size_type i = 0U; i < n; i++) {
+        outOffsets[i] = otherArcs.size();
+        graph->mapOutgoingArcs(otherVertices[i], [&](Arc *a) {
+            size_type h = indexOfOther(a->getHead());
+            otherArcs.push_back(a);
+            outHeads.push_back(h);
+            inOffsets[h + 1]++;
+            if (!dynamic_cast<MultiArc*>(a)) {
+                numSimpleArcs++;
+            }
+        });
+    }
+    const size_type m = otherArcs.size();
+    outOffsets[n] = m;
+
+    simpleArcs.reserve(numSimpleArcs);
+    outArcs.reserve(m);
+    for (size_type i = 0U; i < n; i++) {
+        for (size_type k = outOffsets[i]; k < outOffsets[i + 1]; k++) {
+            Arc *a = otherArcs[k];
+            Vertex *tail = &vertices[i];
+            Vertex *head = &vertices[outHeads[k]];
+            Arc *ta;
+            if (dynamic_cast<MultiArc*>(a)) {
+                MultiArc *ma = createMultiArc(tail, head, a->getSize(), k);
+                multiArcs.push_back(ma);
+                ta = ma;
+            } else {
+                simpleArcs.emplace_back(tail, head, k, this);
+                ta = &simpleArcs.back();
+            }
+            numArcsWithSize += ta->getSize();
+            ta->setName(a->getName());
+            outArcs.push_back(ta);
+            if (otherToThisArcs) {
+                (*otherToThisArcs)[a] = ta;
+            }
+            if (thisToOtherArcs) {
+                (*thisToOtherArcs)[ta] = a;
+            }
+        }
+    }
+
+    buildIncoming();
+    return *this;
+}
+
+StaticDiGraph &StaticDiGraph::assign(size_type numVertices, const std::uint64_t *offsets, const std::uint64_t *heads,
+                                     const std::uint64_t *weightMask, const std::uint64_t *weights)
+{
+    release();
+
+    const size_type n = numVertices;
+    const size_type m = offsets[n];
+    vertices.reserve(n);
+    for (size_type i = 0U; i < n; i++) {
+        vertices.emplace_back(i, this);
+    }
+    outOffsets.assign(offsets, offsets + n + 1);
+    outHeads.assign(heads, heads + m);
+
+    auto isWeighted = [&](size_type k) {
+        return weightMask && ((weightMask[k / 64U] >> (k % 64U)) & 1U);
+    };
+    size_type numSimpleArcs = 0U;
+    for (size_type k = 0U; k < m; k++) {
+        if (!isWeighted(k)) {
+            numSimpleArcs++;
+        }
+    }
+    simpleArcs.reserve(numSimpleArcs);
+    multiArcs.reserve(m - numSimpleArcs);
+    outArcs.reserve(m);
+    for (size_type i = 0U; i < n; i++) {
+        for (size_type k = outOffsets[i]; k < outOffsets[i + 1]; k++) {
+            Vertex *tail = &vertices[i];
+            Vertex *head = &vertices[outHeads[k]];
+            Arc *ta;
+            if (isWeighted(k)) {
+                MultiArc *ma = createMultiArc(tail, head, weights[k], k);
+                multiArcs.push_back(ma);
+                ta = ma;
+            } else {
+                simpleArcs.emplace_back(tail, head, k, this);
+                ta = &simpleArcs.back();
+            }
+            numArcsWithSize += ta->getSize();
+            outArcs.push_back(ta);
+        }
+    }
+
+    inOffsets.assign(n + 1, 0U);
+    for (size_type k = 0U; k < m; k++) {
+        inOffsets[outHeads[k] + 1]++;
+    }
+    buildIncoming();
+    return *this;
+}
+
+Vertex *StaticDiGraph::addVertex()
+{
+    throw std::logic_error("StaticDiGraph is immutable.");
+}
+
+void StaticDiGraph::removeVertex(Vertex *)
+{
+    throw std::logic_error("StaticDiGraph is immutable.");
+}
+
+bool StaticDiGraph::containsVertex(const Vertex *v) const
+{
+    return v->getParent() == this && v->getId() < vertices.size() && &vertices[v->getId()] == v;
+}
+
+Vertex *StaticDiGraph::getAnyVertex() const
+{
+    if (vertices.empty()) {
+        return nullptr;
+    }
+    return const_cast<Vertex*>(&vertices.front());
+}
+
+void StaticDiGraph::mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition)
+{
+    for (Vertex &v : vertices) {
+        if (breakCondition(&v)) {
+            break;
+        }
+        vvFun(&v);
+    }
+}
+
+bool StaticDiGraph::isEmpty() const
+{
+    return vertices.empty();
+}
+
+DiGraph::size_type StaticDiGraph::getSize() const
+{
+    return vertices.size();
+}
+
+void StaticDiGraph::clear()
+{
+    {
+        FarewellBatch farewells(this);
+        for (Arc *a : outArcs) {
+            invalidateArc(a);
+            dismissArc(a);
+        }
+        for (Vertex &v : vertices) {
+            invalidateVertex(&v);
+            dismissVertex(&v);
+        }
+    }
+    release();
+    DiGraph::clear();
+}
+
+Arc *StaticDiGraph::addArc(Vertex *, Vertex *)
+{
+    throw std::logic_error("StaticDiGraph is immutable.");
+}
+
+MultiArc *StaticDiGraph::addMultiArc(Vertex *, Vertex *, size_type)
+{
+    throw std::logic_error("StaticDiGraph is immutable.");
+}
+
+void StaticDiGraph::removeArc(Arc *)
+{
+    throw std::logic_error("StaticDiGraph is immutable.");
+}
+
+bool StaticDiGraph::containsArc(const Arc *a) const
+{
+    return a->getParent() == this && a->getId() < outArcs.size() && outArcs[a->getId()] == a;
+}
+
+Arc *StaticDiGraph::findArc(const Vertex *from, const Vertex *to) const
+{
+    size_type t = checkedIndexOf(from);
+    size_type h = checkedIndexOf(to);
+    if (outEnd(t) - outBegin(t) <= inEnd(h) - inBegin(h)) {
+        for (size_type k = outBegin(t); k < outEnd(t); k++) {
+            if (outHeads[k] == h) {
+                return outArcs[k];
+            }
+        }
+    } else {
+        for (size_type k = inBegin(h); k < inEnd(h); k++) {
+            if (inTails[k] == t) {
+                return inArcs[k];
+            }
+        }
+    }
+    return nullptr;
+}
+
+DiGraph::size_type StaticDiGraph::getNumArcs(bool multiArcsAsSimple) const
+{
+    return multiArcsAsSimple ? outArcs.size() : numArcsWithSize;
+}
+
+DiGraph::size_type StaticDiGraph::getOutDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    size_type i = checkedIndexOf(v);
+    if (multiArcsAsSimple || multiArcs.empty()) {
+        return outEnd(i) - outBegin(i);
+    }
+    size_type deg = 0U;
+    for (size_type k = outBegin(i); k < outEnd(i); k++) {
+        deg += outArcs[k]->getSize();
+    }
+    return deg;
+}
+
+DiGraph::size_type StaticDiGraph::getInDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    size_type i = checkedIndexOf(v);
+    if (multiArcsAsSimple || multiArcs.empty()) {
+        return inEnd(i) - inBegin(i);
+    }
+    size_type deg = 0U;
+    for (size_type k = inBegin(i); k < inEnd(i); k++) {
+        deg += inArcs[k]->getSize();
+    }
+    return deg;
+}
+
+bool StaticDiGraph::isSource(const Vertex *v) const
+{
+    size_type i = checkedIndexOf(v);
+    return inEnd(i) == inBegin(i);
+}
+
+bool StaticDiGraph::isSink(const Vertex *v) const
+{
+    size_type i = checkedIndexOf(v);
+    return outEnd(i) == outBegin(i);
+}
+
+void StaticDiGraph::mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    for (Arc *a : outArcs) {
+        if (breakCondition(a)) {
+            break;
+        }
+        avFun(a);
+    }
+}
+
+void StaticDiGraph::mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    size_type i = checkedIndexOf(v);
+    for (size_type k = outBegin(i); k < outEnd(i); k++) {
+        Arc *a = outArcs[k];
+        if (breakCondition(a)) {
+            break;
+        }
+        avFun(a);
+    }
+}
+
+void StaticDiGraph::mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    size_type i = checkedIndexOf(v);
+    for (size_type k = inBegin(i); k < inEnd(i); k++) {
+        Arc *a = inArcs[k];
+        if (breakCondition(a)) {
+            break;
+        }
+        avFun(a);
+    }
+}
+
+std::string StaticDiGraph::toString() const
+{
+    std::ostringstream strStream;
+    strStream << "StaticDiGraph [";
+    strStream << idString() << "]";
+    return strStream.str();
+}
+
+Vertex *StaticDiGraph::vertexAt(size_type i) const
+{
+    if (i >= vertices.size()) {
+        throw std::invalid_argument("Index must be less than graph size.");
+    }
+    return const_cast<Vertex*>(&vertices[i]);
+}
+
+DiGraph::size_type StaticDiGraph::indexOf(const Vertex *v) const
+{
+    return checkedIndexOf(v);
+}
+
+DiGraph::size_type StaticDiGraph::checkedIndexOf(const Vertex *v) const
+{
+    if (!containsVertex(v)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    return v->getId();
+}
+
+void StaticDiGraph::adopt()
+{
+    for (Vertex &v : vertices) {
+        v.setParent(this);
+    }
+    for (Arc &a : simpleArcs) {
+        a.setParent(this);
+    }
+    for (MultiArc *a : multiArcs) {
+        a->setParent(this);
+    }
+}
+
+// expects inOffsets to hold the in-degree of vertex i at position i + 1
+void StaticDiGraph::buildIncoming()
+{
+    const size_type n = vertices.size();
+    const size_type m = outArcs.size();
+    for (size_type i = 0U; i < n; i++) {
+        inOffsets[i + 1] += inOffsets[i];
+    }
+    std::vector<size_type> inPos(inOffsets.begin(), inOffsets.end() - 1);
+    inTails.resize(m);
+    inArcs.resize(m);
+    for (size_type i = 0U; i < n; i++) {
+        for (size_type k = outOffsets[i]; k < outOffsets[i + 1]; k++) {
+            size_type pos = inPos[outHeads[k]]++;
+            inTails[pos] = i;
+            inArcs[pos] = outArcs[k];
+        }
+    }
+}
+
+void StaticDiGraph::release()
+{
+    for (MultiArc *a : multiArcs) {
+        delete a;
+    }
+    multiArcs.clear();
+    simpleArcs.clear();
+    vertices.clear();
+    outOffsets.assign(1, 0U);
+    outHeads.clear();
+    outArcs.clear();
+    inOffsets.assign(1, 0U);
+    inTails.clear();
+    inArcs.clear();
+    numArcsWithSize = 0U;
+}
+
+}
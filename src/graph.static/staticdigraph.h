@@ -0,0 +1,168 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef STATICDIGRAPH_H
+#define STATICDIGRAPH_H
+
+#include "graph/digraph.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Algora {
+
+template<typename T>
+class ModifiableProperty;
+
+/**
+ * Immutable snapshot of a DiGraph in compressed sparse row layout.
+ * Vertices and arcs are numbered densely in the order of the original graph,
+ * i.e., the id of a vertex equals its index and the id of an arc equals
+ * its position in the outgoing arc array.
+ * All modifying operations throw std::logic_error.
+ */
+class StaticDiGraph : public DiGraph
+{
+public:
+    explicit StaticDiGraph(GraphArtifact *parent = nullptr);
+    explicit StaticDiGraph(DiGraph *graph,
+                           ModifiableProperty<GraphArtifact*> *otherToThisVertices = nullptr,
+                           ModifiableProperty<GraphArtifact*> *otherToThisArcs = nullptr,
+                           ModifiableProperty<GraphArtifact*> *thisToOtherVertices = nullptr,
+                           ModifiableProperty<GraphArtifact*> *thisToOtherArcs = nullptr);
+    virtual ~StaticDiGraph() override;
+
+    // copying
+    StaticDiGraph(const StaticDiGraph &other) = delete;
+    StaticDiGraph &operator=(const StaticDiGraph &other) = delete;
+
+    // moving
+    StaticDiGraph(StaticDiGraph &&other);
+    StaticDiGraph &operator=(StaticDiGraph &&other);
+
+    StaticDiGraph &assign(DiGraph *graph,
+                          ModifiableProperty<GraphArtifact*> *otherToThisVertices = nullptr,
+                          ModifiableProperty<GraphArtifact*> *otherToThisArcs = nullptr,
+                          ModifiableProperty<GraphArtifact*> *thisToOtherVertices = nullptr,
+                          ModifiableProperty<GraphArtifact*> *thisToOtherArcs = nullptr);
+    // Builds the graph directly from arrays in compressed sparse row layout, which must be consistent:
+    // the outgoing arcs of vertex i are those with heads heads[offsets[i]], ..., heads[offsets[i + 1] - 1].
+    // Arc k becomes a WeightedArc of weight weights[k] if bit k % 64 of weightMask[k / 64] is set.
+    StaticDiGraph &assign(size_type numVertices, const std::uint64_t *offsets, const std::uint64_t *heads,
+                          const std::uint64_t *weightMask = nullptr, const std::uint64_t *weights = nullptr);
+
+    // Graph interface
+public:
+    virtual Vertex *addVertex() override;
+    virtual void removeVertex(Vertex *v) override;
+    virtual bool containsVertex(const Vertex *v) const override;
+    virtual Vertex *getAnyVertex() const override;
+    virtual void mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition) override;
+    virtual bool isEmpty() const override;
+    virtual size_type getSize() const override;
+    virtual void clear() override;
+
+    // DiGraph interface
+public:
+    virtual Arc *addArc(Vertex *tail, Vertex *head) override;
+    virtual MultiArc *addMultiArc(Vertex *tail, Vertex *head, size_type size) override;
+    virtual void removeArc(Arc *a) override;
+    virtual bool containsArc(const Arc *a) const override;
+    virtual Arc *findArc(const Vertex *from, const Vertex *to) const override;
+    virtual size_type getNumArcs(bool multiArcsAsSimple) const override;
+
+    virtual size_type getOutDegree(const Vertex *v, bool multiArcsAsSimple) const override;
+    virtual size_type getInDegree(const Vertex *v, bool multiArcsAsSimple) const override;
+    virtual bool isSource(const Vertex *v) const override;
+    virtual bool isSink(const Vertex *v) const override;
+
+    virtual void mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+
+    // inlined iteration; f may return false to stop early
+    template<typename F>
+    bool forEachOutgoing(const Vertex *v, F &&f) const {
+        size_type i = checkedIndexOf(v);
+        for (size_type k = outBegin(i); k < outEnd(i); k++) {
+            if (!invokeAndContinue(f, outArcs[k])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    template<typename F>
+    bool forEachIncoming(const Vertex *v, F &&f) const {
+        size_type i = checkedIndexOf(v);
+        for (size_type k = inBegin(i); k < inEnd(i); k++) {
+            if (!invokeAndContinue(f, inArcs[k])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // GraphArtifact interface
+public:
+    virtual std::string toString() const override;
+
+    // index-based access
+public:
+    Vertex *vertexAt(size_type i) const;
+    size_type indexOf(const Vertex *v) const;
+
+    size_type outBegin(size_type i) const { return outOffsets[i]; }
+    size_type outEnd(size_type i) const { return outOffsets[i + 1]; }
+    size_type headIndexAt(size_type k) const { return outHeads[k]; }
+    Arc *outgoingArcAt(size_type k) const { return outArcs[k]; }
+
+    size_type inBegin(size_type i) const { return inOffsets[i]; }
+    size_type inEnd(size_type i) const { return inOffsets[i + 1]; }
+    size_type tailIndexAt(size_type k) const { return inTails[k]; }
+    Arc *incomingArcAt(size_type k) const { return inArcs[k]; }
+
+    bool hasMultiArcs() const { return !multiArcs.empty(); }
+
+private:
+    std::vector<Vertex> vertices;
+    std::vector<Arc> simpleArcs;
+    std::vector<MultiArc*> multiArcs;
+
+    std::vector<size_type> outOffsets;
+    std::vector<size_type> outHeads;
+    std::vector<Arc*> outArcs;
+
+    std::vector<size_type> inOffsets;
+    std::vector<size_type> inTails;
+    std::vector<Arc*> inArcs;
+
+    size_type numArcsWithSize;
+
+    size_type checkedIndexOf(const Vertex *v) const;
+    void buildIncoming();
+    void adopt();
+    void release();
+};
+
+}
+
+#endif // STATICDIGRAPH_H
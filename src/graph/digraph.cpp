@@ -46,6 +46,19 @@ DiGraph &DiGraph::operator=(const DiGraph &other)
     return *this;
 }
 
+void DiGraph::addArcs(const ArcEndpoints *arcs, size_type num, std::vector<Arc *> *added)
+{
+    if (added) {
+        added->reserve(added->size() + num);
+    }
+    for (size_type i = 0; i < num; i++) {
+        Arc *a = addArc(arcs[i].first, arcs[i].second);
+        if (added) {
+            added->push_back(a);
+        }
+    }
+}
+
 DiGraph::size_type DiGraph::getNumArcs(bool multiArcsAsSimple) const
 {
     DiGraph *me = const_cast<DiGraph*>(this);
@@ -55,14 +68,14 @@ DiGraph::size_type DiGraph::getNumArcs(bool multiArcsAsSimple) const
     return numArcs;
 }
 
-void DiGraph::onArcAdd(void *id, const ArcMapping &avFun)
+void DiGraph::onArcAdd(void *id, const ArcMapping &avFun, const ArcBatchMapping &batchFun)
 {
-    observableArcGreetings.addObserver(id, avFun);
+    observableArcGreetings.addObserver(id, avFun, batchFun);
 }
 
-void DiGraph::onArcRemove(void *id, const ArcMapping &avFun)
+void DiGraph::onArcRemove(void *id, const ArcMapping &avFun, const ArcBatchMapping &batchFun)
 {
-    observableArcFarewells.addObserver(id, avFun);
+    observableArcFarewells.addObserver(id, avFun, batchFun);
 }
 
 void DiGraph::removeOnArcAdd(void *id)
@@ -80,6 +93,38 @@ void DiGraph::clear()
     Graph::clear();
 }
 
+void DiGraph::beginUpdateBatch()
+{
+    Graph::beginUpdateBatch();
+    observableArcGreetings.beginBatch();
+}
+
+void DiGraph::endUpdateBatch()
+{
+    Graph::endUpdateBatch();
+    observableArcGreetings.endBatch();
+}
+
+void DiGraph::flushGreetings()
+{
+    // vertices first, so that observers know all endpoints of new arcs
+    Graph::flushGreetings();
+    observableArcGreetings.flush();
+}
+
+void DiGraph::beginFarewellBatch()
+{
+    Graph::beginFarewellBatch();
+    observableArcFarewells.beginBatch();
+}
+
+void DiGraph::endFarewellBatch()
+{
+    // arcs first, they are dismissed before their end vertices
+    observableArcFarewells.endBatch();
+    Graph::endFarewellBatch();
+}
+
 std::string DiGraph::toString() const
 {
     std::ostringstream strStream;
@@ -39,6 +39,8 @@ class PropertyMap;
 class DiGraph : public Graph
 {
 public:
+    typedef std::pair<Vertex*, Vertex*> ArcEndpoints;
+
     explicit DiGraph(GraphArtifact *parent = nullptr);
     virtual ~DiGraph() override { }
 
@@ -59,6 +61,13 @@ public:
     virtual bool containsArc(const Arc *a) const = 0;
     virtual Arc *findArc(const Vertex *from, const Vertex *to) const = 0;
 
+    // Adds num simple arcs, given as (tail, head) pairs;
+    // if added is given, the new arcs are appended to it in the same order.
+    virtual void addArcs(const ArcEndpoints *arcs, size_type num, std::vector<Arc*> *added = nullptr);
+    void addArcs(const std::vector<ArcEndpoints> &arcs, std::vector<Arc*> *added = nullptr) {
+        addArcs(arcs.data(), arcs.size(), added);
+    }
+
     virtual size_type getOutDegree(const Vertex *v, bool multiArcsAsSimple) const = 0;
     virtual size_type getInDegree(const Vertex *v, bool multiArcsAsSimple) const = 0;
     virtual size_type getDegree(const Vertex *v, bool multiArcsAsSimple) const {
@@ -75,8 +84,10 @@ public:
     }
     virtual size_type getNumArcs(bool multiArcsAsSimple) const;
 
-    virtual void onArcAdd(void *id, const ArcMapping &avFun);
-    virtual void onArcRemove(void *id, const ArcMapping &avFun);
+    virtual void onArcAdd(void *id, const ArcMapping &avFun,
+                          const ArcBatchMapping &batchFun = ArcBatchMapping());
+    virtual void onArcRemove(void *id, const ArcMapping &avFun,
+                             const ArcBatchMapping &batchFun = ArcBatchMapping());
     virtual void removeOnArcAdd(void *id);
     virtual void removeOnArcRemove(void *id);
 
@@ -101,18 +112,50 @@ public:
     virtual void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) = 0;
     virtual void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) = 0;
 
+    // Templated iteration; f may return false to stop early.
+    // Returns true iff all arcs have been visited.
+    // Concrete graph types hide these by inlined versions, see dispatchDiGraph().
+    template<typename F>
+    bool forEachOutgoing(const Vertex *v, F &&f) {
+        bool go = true;
+        mapOutgoingArcsUntil(v, [&f, &go](Arc *a) { go = invokeAndContinue(f, a); },
+                             [&go](const Arc *) { return !go; });
+        return go;
+    }
+    template<typename F>
+    bool forEachIncoming(const Vertex *v, F &&f) {
+        bool go = true;
+        mapIncomingArcsUntil(v, [&f, &go](Arc *a) { go = invokeAndContinue(f, a); },
+                             [&go](const Arc *) { return !go; });
+        return go;
+    }
+
     virtual void clear() override;
 
+    virtual void beginUpdateBatch() override;
+    virtual void endUpdateBatch() override;
+
     // GraphArtifact interface
 public:
     virtual std::string toString() const override;
 
 protected:
-   Observable<Arc*> observableArcGreetings;
-   Observable<Arc*> observableArcFarewells;
+   BatchObservable<Arc*> observableArcGreetings;
+   BatchObservable<Arc*> observableArcFarewells;
 
    void greetArc(Arc *a) { observableArcGreetings.notifyObservers(a); }
-   void dismissArc(Arc *a) { observableArcFarewells.notifyObservers(a); }
+   void greetArcs(Arc * const *arcs, size_type num) { observableArcGreetings.notifyObservers(arcs, num); }
+   void dismissArc(Arc *a) {
+       flushPendingGreetings();
+       observableArcFarewells.notifyObservers(a);
+   }
+   void dismissArcs(Arc * const *arcs, size_type num) {
+       flushPendingGreetings();
+       observableArcFarewells.notifyObservers(arcs, num);
+   }
+   virtual void flushGreetings() override;
+   virtual void beginFarewellBatch() override;
+   virtual void endFarewellBatch() override;
 
     virtual Arc *createArc(Vertex *tail, Vertex *head) {
         return new Arc(tail, head, this);
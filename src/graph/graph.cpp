@@ -22,15 +22,17 @@
 
 #include "graph.h"
 
+#include <stdexcept>
+
 namespace Algora {
 
 Graph::Graph(GraphArtifact *parent)
-    : GraphArtifact(parent) { }
+    : GraphArtifact(parent), updateBatchLevel(0U) { }
 
 Graph::Graph(const Graph &other)
-    : GraphArtifact(other)
+    : GraphArtifact(other), updateBatchLevel(0U)
 {
-    // do not copy observers
+    // do not copy observers or names of vertices and arcs
 }
 
 Graph &Graph::operator=(const Graph &other)
@@ -44,13 +46,13 @@ Graph &Graph::operator=(const Graph &other)
     return *this;
 }
 
-void Graph::onVertexAdd(void *id, const VertexMapping &vvFun) {
-    observableVertexGreetings.addObserver(id, vvFun);
+void Graph::onVertexAdd(void *id, const VertexMapping &vvFun, const VertexBatchMapping &batchFun) {
+    observableVertexGreetings.addObserver(id, vvFun, batchFun);
 }
 
-void Graph::onVertexRemove(void *id, const VertexMapping &vvFun)
+void Graph::onVertexRemove(void *id, const VertexMapping &vvFun, const VertexBatchMapping &batchFun)
 {
-    observableVertexFarewells.addObserver(id, vvFun);
+    observableVertexFarewells.addObserver(id, vvFun, batchFun);
 }
 
 void Graph::removeOnVertexAdd(void *id)
@@ -63,6 +65,53 @@ void Graph::removeOnVertexRemove(void *id)
     observableVertexFarewells.removeObserver(id);
 }
 
+void Graph::beginUpdateBatch()
+{
+    updateBatchLevel++;
+    observableVertexGreetings.beginBatch();
+}
+
+void Graph::endUpdateBatch()
+{
+    if (updateBatchLevel == 0U) {
+        throw std::logic_error("No update batch in progress.");
+    }
+    if (updateBatchLevel == 1U) {
+        flushGreetings();
+    }
+    updateBatchLevel--;
+    observableVertexGreetings.endBatch();
+}
+
+void Graph::flushGreetings()
+{
+    observableVertexGreetings.flush();
+}
+
+void Graph::beginFarewellBatch()
+{
+    flushPendingGreetings();
+    observableVertexFarewells.beginBatch();
+}
+
+void Graph::endFarewellBatch()
+{
+    observableVertexFarewells.endBatch();
+}
+
+void Graph::addVertices(size_type n, std::vector<Vertex *> *added)
+{
+    if (added) {
+        added->reserve(added->size() + n);
+    }
+    for (size_type i = 0; i < n; i++) {
+        Vertex *v = addVertex();
+        if (added) {
+            added->push_back(v);
+        }
+    }
+}
+
 void Graph::clear()
 {
 }
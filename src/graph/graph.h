@@ -58,11 +58,40 @@ public:
     virtual bool containsVertex(const Vertex *v) const = 0;
     virtual Vertex *getAnyVertex() const = 0;
 
-    virtual void onVertexAdd(void *id, const VertexMapping &vvFun);
-    virtual void onVertexRemove(void *id, const VertexMapping &vvFun);
+    // Adds n vertices; if added is given, the new vertices are appended to it.
+    virtual void addVertices(size_type n, std::vector<Vertex*> *added = nullptr);
+
+    // If a batch function is given, it receives batched notifications at once,
+    // see beginUpdateBatch(); vvFun may then be empty.
+    virtual void onVertexAdd(void *id, const VertexMapping &vvFun,
+                             const VertexBatchMapping &batchFun = VertexBatchMapping());
+    virtual void onVertexRemove(void *id, const VertexMapping &vvFun,
+                                const VertexBatchMapping &batchFun = VertexBatchMapping());
     virtual void removeOnVertexAdd(void *id);
     virtual void removeOnVertexRemove(void *id);
 
+    // Between beginUpdateBatch() and endUpdateBatch(), greetings of new artifacts to observers
+    // with a batch function are buffered and delivered in batches when the outermost batch ends;
+    // observers without one are notified right away, as outside of batches.
+    // Removals are still announced immediately, but only after all buffered greetings.
+    // Batches may be nested.
+    virtual void beginUpdateBatch();
+    virtual void endUpdateBatch();
+    bool isInUpdateBatch() const { return updateBatchLevel > 0; }
+
+    // Update batch for the lifetime of the object;
+    // the batch also ends if an exception leaves the scope.
+    // The graph readers wrap each graph they build in one.
+    class UpdateBatch {
+    public:
+        explicit UpdateBatch(Graph *graph) : graph(graph) { graph->beginUpdateBatch(); }
+        ~UpdateBatch() noexcept(false) { graph->endUpdateBatch(); }
+        UpdateBatch(const UpdateBatch &) = delete;
+        UpdateBatch &operator=(const UpdateBatch &) = delete;
+    private:
+        Graph *graph;
+    };
+
     // Accomodate visitors
     virtual void acceptVertexVisitor(VertexVisitor *nVisitor) {
         mapVertices(nVisitor->getVisitorFunction());
@@ -79,11 +108,47 @@ public:
     virtual void clear();
 
 protected:
-   Observable<Vertex*> observableVertexGreetings;
-   Observable<Vertex*> observableVertexFarewells;
+   BatchObservable<Vertex*> observableVertexGreetings;
+   BatchObservable<Vertex*> observableVertexFarewells;
 
    void greetVertex(Vertex *v) { observableVertexGreetings.notifyObservers(v); }
-   void dismissVertex(Vertex *v) { observableVertexFarewells.notifyObservers(v); }
+   void greetVertices(Vertex * const *vertices, size_type num) {
+       observableVertexGreetings.notifyObservers(vertices, num);
+   }
+   void dismissVertex(Vertex *v) {
+       flushPendingGreetings();
+       observableVertexFarewells.notifyObservers(v);
+   }
+   void dismissVertices(Vertex * const *vertices, size_type num) {
+       flushPendingGreetings();
+       observableVertexFarewells.notifyObservers(vertices, num);
+   }
+   // delivers greetings buffered by an update batch;
+   // removals should call this before invalidating anything
+   void flushPendingGreetings() {
+       if (isInUpdateBatch()) {
+           flushGreetings();
+       }
+   }
+   virtual void flushGreetings();
+   // buffers farewells for batch observers until endFarewellBatch(), other observers are
+   // notified right away; dismissed artifacts must not be freed before then
+   virtual void beginFarewellBatch();
+   virtual void endFarewellBatch();
+
+   // farewell batch for the lifetime of the object, see UpdateBatch
+   class FarewellBatch {
+   public:
+       explicit FarewellBatch(Graph *graph) : graph(graph) { graph->beginFarewellBatch(); }
+       ~FarewellBatch() noexcept(false) { graph->endFarewellBatch(); }
+       FarewellBatch(const FarewellBatch &) = delete;
+       FarewellBatch &operator=(const FarewellBatch &) = delete;
+   private:
+       Graph *graph;
+   };
+
+   // names of vertices and arcs
+   virtual NameTable *getNameTable() override { return &artifactNames; }
 
     Vertex *createVertex() {
         return new Vertex(this);
@@ -97,6 +162,9 @@ protected:
         v->invalidate();
     }
 
+private:
+    unsigned int updateBatchLevel;
+    NameTable artifactNames;
 };
 
 }
@@ -23,7 +23,9 @@
 #ifndef GRAPH_FUNCTIONAL_H
 #define GRAPH_FUNCTIONAL_H
 
+#include <cstddef>
 #include <functional>
+#include <type_traits>
 
 namespace Algora {
 
@@ -33,6 +35,9 @@ class Arc;
 typedef std::function<void(Vertex *v)> VertexMapping;
 typedef std::function<void(Arc *a)> ArcMapping;
 
+typedef std::function<void(Vertex * const *vertices, std::size_t num)> VertexBatchMapping;
+typedef std::function<void(Arc * const *arcs, std::size_t num)> ArcBatchMapping;
+
 typedef std::function<void(const Vertex *v)> ConstVertexMapping;
 typedef std::function<void(const Arc *a)> ConstArcMapping;
 
@@ -48,6 +53,18 @@ extern const VertexPredicate vertexFalse;
 extern const ArcPredicate arcTrue;
 extern const ArcPredicate arcFalse;
 
+// Invokes f on the given artifact for templated iteration (forEach...).
+// If f returns bool, false means "stop"; otherwise, iteration always continues.
+template<typename F, typename T>
+inline bool invokeAndContinue(F &f, T *t) {
+    if constexpr (std::is_same<typename std::invoke_result<F&, T*>::type, bool>::value) {
+        return f(t);
+    } else {
+        f(t);
+        return true;
+    }
+}
+
 }
 
 #endif // GRAPH_FUNCTIONAL_H
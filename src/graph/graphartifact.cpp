@@ -29,25 +29,29 @@ namespace Algora {
 GraphArtifact::id_type GraphArtifact::nextId = 0ULL;
 
 GraphArtifact::GraphArtifact(id_type id, GraphArtifact *parent)
-    : id(id), parent(parent), valid(true)
+    : id(id), parent(parent), valid(true), named(false)
 {
 
 }
 
 GraphArtifact::GraphArtifact(GraphArtifact *parent)
-    : id(nextId), parent(parent), valid(true)
+    : id(nextId), parent(parent), valid(true), named(false)
 {
     nextId++;
 }
 
 GraphArtifact::~GraphArtifact()
 {
+    reset();
 }
 
 GraphArtifact::GraphArtifact(const GraphArtifact &other)
-    : id(nextId), parent(other.parent), valid(other.valid), name(other.name)
+    : id(nextId), parent(other.parent), valid(other.valid), named(false)
 {
     nextId++;
+    if (other.named) {
+        setName(other.getName());
+    }
 }
 
 GraphArtifact &GraphArtifact::operator=(const GraphArtifact &other)
@@ -56,14 +60,107 @@ GraphArtifact &GraphArtifact::operator=(const GraphArtifact &other)
         return *this;
     }
 
+    std::string otherName = other.getName();
+    reset();
+
     // keep my id
     parent = other.parent;
     valid = other.valid;
-    name = other.name;
+    setName(otherName);
+
+    return *this;
+}
+
+GraphArtifact::GraphArtifact(GraphArtifact &&other)
+    : id(other.id), parent(other.parent), valid(other.valid), named(false)
+{
+    takeNameFrom(other);
+}
+
+GraphArtifact &GraphArtifact::operator=(GraphArtifact &&other)
+{
+    if (&other == this) {
+        return *this;
+    }
+
+    reset();
+    id = other.id;
+    parent = other.parent;
+    valid = other.valid;
+    takeNameFrom(other);
 
     return *this;
 }
 
+void GraphArtifact::setName(const std::string &n)
+{
+    if (n.empty()) {
+        reset();
+        return;
+    }
+    nameTable()[this] = n;
+    named = true;
+}
+
+const std::string &GraphArtifact::getName() const
+{
+    static const std::string noName;
+    if (!named) {
+        return noName;
+    }
+    const NameTable &names = nameTable();
+    auto i = names.find(this);
+    return i == names.end() ? noName : i->second;
+}
+
+void GraphArtifact::setParent(GraphArtifact *p)
+{
+    if (!named || p == parent) {
+        parent = p;
+        return;
+    }
+    NameTable &oldNames = nameTable();
+    auto i = oldNames.find(this);
+    if (i == oldNames.end()) {
+        // the table has been moved along with the parent
+        parent = p;
+        return;
+    }
+    std::string n = std::move(i->second);
+    oldNames.erase(i);
+    parent = p;
+    nameTable()[this] = std::move(n);
+}
+
+GraphArtifact::NameTable &GraphArtifact::nameTable() const
+{
+    static NameTable globalNames;
+    NameTable *names = parent ? parent->getNameTable() : nullptr;
+    return names ? *names : globalNames;
+}
+
+void GraphArtifact::removeName()
+{
+    nameTable().erase(this);
+    named = false;
+}
+
+void GraphArtifact::takeNameFrom(GraphArtifact &other)
+{
+    if (!other.named) {
+        return;
+    }
+    NameTable &otherNames = other.nameTable();
+    auto i = otherNames.find(&other);
+    if (i != otherNames.end()) {
+        std::string n = std::move(i->second);
+        otherNames.erase(i);
+        nameTable()[this] = std::move(n);
+        named = true;
+    }
+    other.named = false;
+}
+
 std::string GraphArtifact::idString() const
 {
     std::ostringstream strStream;
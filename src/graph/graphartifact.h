@@ -24,6 +24,7 @@
 #define GRAPHARTIFACT_H
 
 #include <string>
+#include <unordered_map>
 
 namespace Algora {
 
@@ -32,6 +33,7 @@ class GraphArtifact
 public:
     typedef std::size_t size_type;
     typedef std::size_t id_type;
+    typedef std::unordered_map<const GraphArtifact*, std::string> NameTable;
 
     explicit GraphArtifact(id_type id, GraphArtifact *parent = nullptr);
     explicit GraphArtifact(GraphArtifact *parent = nullptr);
@@ -42,8 +44,8 @@ public:
     GraphArtifact& operator=(const GraphArtifact &other);
 
     // moving
-    GraphArtifact(GraphArtifact &&other) = default;
-    GraphArtifact& operator=(GraphArtifact &&other) = default;
+    GraphArtifact(GraphArtifact &&other);
+    GraphArtifact& operator=(GraphArtifact &&other);
 
     id_type getId() const { return id; }
     GraphArtifact *getParent() const { return parent; }
@@ -55,23 +57,29 @@ public:
 
     bool isValid() const { return valid; }
 
-    void setName(const std::string &n) {
-        name = n;
-    }
-    const std::string &getName() const {
-        return name;
-    }
+    // Names are kept in a side table of the parent (see getNameTable()),
+    // so unnamed artifacts carry no string. An empty name removes the entry.
+    // Not thread-safe: do not name artifacts of the same parent concurrently.
+    void setName(const std::string &n);
+    const std::string &getName() const;
+    bool hasName() const { return named; }
 
     // needed to implement move semantics in graph classes
-    virtual void setParent(GraphArtifact *p) {
-       parent = p;
-    }
+    virtual void setParent(GraphArtifact *p);
 
 protected:
     std::string idString() const;
     void invalidate() { valid = false; }
     void revalidate() { valid = true; }
-    void reset() { name.clear(); }
+    void reset() {
+        if (named) {
+            removeName();
+        }
+    }
+
+    // table for the names of artifacts that have this one as parent;
+    // if nullptr, names are stored in a global table
+    virtual NameTable *getNameTable() { return nullptr; }
 
 private:
     static id_type nextId;
@@ -79,7 +87,11 @@ private:
     id_type id;
     GraphArtifact *parent;
     bool valid;
-    std::string name;
+    bool named;
+
+    NameTable &nameTable() const;
+    void removeName();
+    void takeNameFrom(GraphArtifact &other);
 };
 
 }
@@ -32,13 +32,22 @@ namespace Algora {
 
 
 SubDiGraph::SubDiGraph(DiGraph *graph, Property<bool> &inherit)
-    : superGraph(graph), inSubGraph(inherit)
+    : SubDiGraph(graph, inherit, inherit)
+{ }
+
+SubDiGraph::SubDiGraph(DiGraph *graph, Property<bool> &vertexInherit, Property<bool> &arcInherit)
+    : superGraph(graph), vertexInSubGraph(vertexInherit), arcInSubGraph(arcInherit)
 {
     graph->onVertexAdd(this, [&](Vertex *v) {
         if (inSubGraph(v)) {
           greetVertex(v);
         }
+    }, [&](Vertex * const *vertices, std::size_t num) {
+        auto selected = selectVertices(vertices, num);
+        greetVertices(selected.data(), selected.size());
     });
+    // farewells are forwarded one by one, so that observers of this graph
+    // are notified before the next artifact is invalidated
     graph->onVertexRemove(this, [&](Vertex *v) {
         if (inSubGraph(v)) {
             dismissVertex(v);
@@ -48,6 +57,9 @@ SubDiGraph::SubDiGraph(DiGraph *graph, Property<bool> &inherit)
         if (inSubGraph(a) && inSubGraph(a->getTail()) && inSubGraph(a->getHead())) {
             greetArc(a);
         }
+    }, [&](Arc * const *arcs, std::size_t num) {
+        auto selected = selectArcs(arcs, num);
+        greetArcs(selected.data(), selected.size());
     });
     graph->onArcRemove(this, [&](Arc *a) {
         if (inSubGraph(a) && inSubGraph(a->getTail()) && inSubGraph(a->getHead())) {
@@ -64,6 +76,51 @@ SubDiGraph::~SubDiGraph()
     superGraph->removeOnArcRemove(this);
 }
 
+void SubDiGraph::beginUpdateBatch()
+{
+    DiGraph::beginUpdateBatch();
+    superGraph->beginUpdateBatch();
+}
+
+void SubDiGraph::endUpdateBatch()
+{
+    superGraph->endUpdateBatch();
+    DiGraph::endUpdateBatch();
+}
+
+bool SubDiGraph::inSubGraph(const Vertex *v) const
+{
+    return vertexInSubGraph(v);
+}
+
+bool SubDiGraph::inSubGraph(const Arc *a) const
+{
+    return a && arcInSubGraph(a);
+}
+
+std::vector<Vertex *> SubDiGraph::selectVertices(Vertex * const *vertices, size_type num) const
+{
+    std::vector<Vertex*> selected;
+    for (size_type i = 0; i < num; i++) {
+        if (inSubGraph(vertices[i])) {
+            selected.push_back(vertices[i]);
+        }
+    }
+    return selected;
+}
+
+std::vector<Arc *> SubDiGraph::selectArcs(Arc * const *arcs, size_type num) const
+{
+    std::vector<Arc*> selected;
+    for (size_type i = 0; i < num; i++) {
+        Arc *a = arcs[i];
+        if (inSubGraph(a) && inSubGraph(a->getTail()) && inSubGraph(a->getHead())) {
+            selected.push_back(a);
+        }
+    }
+    return selected;
+}
+
 Vertex *SubDiGraph::addVertex()
 {
     Vertex *v = superGraph->addVertex();
@@ -261,7 +318,7 @@ DiGraph *SubDiGraph::createReversedGraph(PropertyMap<GraphArtifact *> &map) cons
     DiGraph *superRev = superGraph->createReversedGraph(map);
     std::vector<Vertex*> rmVertices;
     superRev->mapVertices([&](Vertex *v) {
-        if (!inSubGraph(map(v))) {
+        if (!inSubGraph(static_cast<Vertex*>(map(v)))) {
             rmVertices.push_back(v);
         }
     });
@@ -272,7 +329,7 @@ DiGraph *SubDiGraph::createReversedGraph(PropertyMap<GraphArtifact *> &map) cons
     }
     std::vector<Arc*> rmArcs;
     superRev->mapArcs([&](Arc *a) {
-        if (!inSubGraph(map(a))) {
+        if (!inSubGraph(static_cast<Arc*>(map(a)))) {
             rmArcs.push_back(a);
         }
     });
@@ -34,6 +34,7 @@ class SubDiGraph : public DiGraph
 {
 public:
     SubDiGraph(DiGraph *graph, Property<bool> &inherit);
+    SubDiGraph(DiGraph *graph, Property<bool> &vertexInherit, Property<bool> &arcInherit);
     virtual ~SubDiGraph();
 
     // Graph interface
@@ -46,6 +47,9 @@ public:
     virtual bool isEmpty() const override;
     virtual size_type getSize() const override;
 
+    virtual void beginUpdateBatch() override;
+    virtual void endUpdateBatch() override;
+
     // DiGraph interface
 public:
     using DiGraph::mapArcs;
@@ -66,7 +70,13 @@ public:
 
 private:
     DiGraph *superGraph;
-    Property<bool> &inSubGraph;
+    Property<bool> &vertexInSubGraph;
+    Property<bool> &arcInSubGraph;
+
+    bool inSubGraph(const Vertex *v) const;
+    bool inSubGraph(const Arc *a) const;
+    std::vector<Vertex*> selectVertices(Vertex * const *vertices, size_type num) const;
+    std::vector<Arc*> selectArcs(Arc * const *arcs, size_type num) const;
 };
 
 }
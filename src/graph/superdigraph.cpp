@@ -60,6 +60,8 @@ SuperDiGraph::SuperDiGraph(DiGraph *graph)
     grin->extra = new IncidenceListGraphImplementation(this);
     graph->onVertexAdd(this, [&](Vertex *v) {
         greetVertex(v);
+    }, [&](Vertex * const *vertices, std::size_t num) {
+        greetVertices(vertices, num);
     });
     graph->onVertexRemove(this, [&](Vertex *v) {
         dismissVertex(v);
@@ -74,7 +76,10 @@ SuperDiGraph::SuperDiGraph(DiGraph *graph)
     });
     graph->onArcAdd(this, [&](Arc *a) {
         greetArc(a);
+    }, [&](Arc * const *arcs, std::size_t num) {
+        greetArcs(arcs, num);
     });
+    // farewells are forwarded one by one, see SubDiGraph
     graph->onArcRemove(this, [&](Arc *a) {
         dismissArc(a);
     });
@@ -100,6 +105,18 @@ Vertex *SuperDiGraph::addVertex()
     return v;
 }
 
+void SuperDiGraph::beginUpdateBatch()
+{
+    DiGraph::beginUpdateBatch();
+    grin->subGraph->beginUpdateBatch();
+}
+
+void SuperDiGraph::endUpdateBatch()
+{
+    grin->subGraph->endUpdateBatch();
+    DiGraph::endUpdateBatch();
+}
+
 void SuperDiGraph::removeVertex(Vertex *v)
 {
     if (v->getParent() == this) {
@@ -43,6 +43,9 @@ public:
     virtual bool isEmpty() const override;
     virtual size_type getSize() const override;
 
+    virtual void beginUpdateBatch() override;
+    virtual void endUpdateBatch() override;
+
     virtual void clear() override;
 
     // DiGraph interface
@@ -21,24 +21,42 @@
  */
 
 #include "adjacencyliststringreader.h"
+#include "mappedfile.h"
 
 #include "graph/digraph.h"
 
 #include <vector>
-#include <stdexcept>
+#include <charconv>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <memory>
 #include <sstream>
 
 namespace Algora {
 
+constexpr AdjacencyListStringReader::size_type AdjacencyListStringReader::DEFAULT_MAX_VERTICES;
+
 class AdjacencyListStringReader::CheshireCat {
 public:
     AdjacencyListStringFormat format;
     std::string lastError;
+    size_type maxVertices;
+
+    MappedFile mappedFile;
+    std::unique_ptr<std::ifstream> ownInput;
+    const char *bufferPos;
+    const char *bufferEnd;
+    std::string record;
+
+    explicit CheshireCat(AdjacencyListStringFormat &f) : format(f), maxVertices(DEFAULT_MAX_VERTICES),
+        bufferPos(nullptr), bufferEnd(nullptr) { }
 
-    explicit CheshireCat(AdjacencyListStringFormat &f) : format(f) { }
+    template<typename NextRecord>
+    bool read(DiGraph *graph, const NextRecord &nextRecord);
 };
 
-bool parseInt(std::string s, int *i, std::string &err);
+bool parseInt(const char *begin, const char *end, long long *i, std::string &err);
 
 AdjacencyListStringReader::AdjacencyListStringReader(std::istream *input, AdjacencyListStringFormat format)
     : StreamDiGraphReader(input), grin(new CheshireCat(format))
@@ -56,76 +74,164 @@ std::string AdjacencyListStringReader::getLastError() const
     return grin->lastError;
 }
 
-bool AdjacencyListStringReader::provideDiGraph(DiGraph *graph)
+void AdjacencyListStringReader::setMaxVertices(size_type n)
+{
+    grin->maxVertices = n;
+}
+
+bool AdjacencyListStringReader::openFile(const std::string &fileName)
 {
-    if (StreamDiGraphReader::inputStream == nullptr) {
+    StreamDiGraphReader::inputStream = nullptr;
+    grin->ownInput.reset();
+    grin->bufferPos = grin->bufferEnd = nullptr;
+    if (grin->mappedFile.open(fileName)) {
+        grin->bufferPos = grin->mappedFile.begin();
+        grin->bufferEnd = grin->mappedFile.end();
+        return true;
+    }
+    grin->ownInput.reset(new std::ifstream(fileName, std::ios::binary));
+    if (!grin->ownInput->is_open()) {
+        grin->ownInput.reset();
+        grin->lastError = "Failed to open " + fileName;
         return false;
     }
-    std::istream &inputStream = *(StreamDiGraphReader::inputStream);
-    using namespace std;
-    string token;
+    StreamDiGraphReader::inputStream = grin->ownInput.get();
+    return true;
+}
 
-    getline(inputStream, token, grin->format.getVertexSeparator());
+void AdjacencyListStringReader::setInputBuffer(const char *begin, const char *end)
+{
+    StreamDiGraphReader::inputStream = nullptr;
+    grin->ownInput.reset();
+    grin->mappedFile.close();
+    grin->bufferPos = begin;
+    grin->bufferEnd = end;
+}
 
-    if (!inputStream) {
-        grin->lastError = "Failed to read number of vertices";
-        return false;
+bool AdjacencyListStringReader::isGraphAvailable()
+{
+    if (StreamDiGraphReader::inputStream != nullptr) {
+        return StreamDiGraphReader::isGraphAvailable();
     }
+    return grin->bufferPos != grin->bufferEnd;
+}
 
-    int numVertices;
-    if (!parseInt(token, &numVertices, grin->lastError)) {
-        return false;
+bool AdjacencyListStringReader::provideDiGraph(DiGraph *graph)
+{
+    const char vertexSeparator = grin->format.getVertexSeparator();
+    if (StreamDiGraphReader::inputStream != nullptr) {
+        std::istream &inputStream = *(StreamDiGraphReader::inputStream);
+        std::string &record = grin->record;
+        return grin->read(graph, [&](const char *&begin, const char *&end) {
+            if (!std::getline(inputStream, record, vertexSeparator)) {
+                return false;
+            }
+            begin = record.data();
+            end = begin + record.size();
+            return true;
+        });
     }
+    // records are parsed in place
+    const char *&pos = grin->bufferPos;
+    const char *bufferEnd = grin->bufferEnd;
+    return grin->read(graph, [&](const char *&begin, const char *&end) {
+        if (pos == bufferEnd) {
+            return false;
+        }
+        begin = pos;
+        end = static_cast<const char*>(std::memchr(pos, vertexSeparator, static_cast<size_t>(bufferEnd - pos)));
+        if (end) {
+            pos = end + 1;
+        } else {
+            end = bufferEnd;
+            pos = bufferEnd;
+        }
+        return true;
+    });
+}
 
-    vector<Vertex*> vertices;
-    for (int i = 0; i < numVertices; i++) {
-        vertices.push_back(graph->addVertex());
-    }
+template<typename NextRecord>
+bool AdjacencyListStringReader::CheshireCat::read(DiGraph *graph, const NextRecord &nextRecord)
+{
+    using namespace std;
+    const char *begin, *end;
 
-    int currVertex = 0;
-    int adjVertex;
-    while (currVertex < numVertices
-           && getline(inputStream, token, grin->format.getVertexSeparator())) {
+    if (!nextRecord(begin, end)) {
+        lastError = "Failed to read number of vertices";
+        return false;
+    }
 
-        istringstream adjacencyStream(token);
+    long long numVertices;
+    if (!parseInt(begin, end, &numVertices, lastError)) {
+        return false;
+    }
+    if (numVertices > 0 && static_cast<unsigned long long>(numVertices) > maxVertices) {
+        ostringstream stringStream;
+        stringStream << "Number of vertices " << numVertices << " exceeds the maximum of " << maxVertices << ".";
+        lastError = stringStream.str();
+        return false;
+    }
 
-        while (getline(adjacencyStream, token, grin->format.getArcSeparator())) {
-            if (!parseInt(token, &adjVertex, grin->lastError)) {
+    DiGraph::UpdateBatch batch(graph);
+    vector<Vertex*> vertices;
+    graph->addVertices(numVertices > 0 ? static_cast<DiGraph::size_type>(numVertices) : 0U, &vertices);
+    vector<DiGraph::ArcEndpoints> arcs;
+
+    const char arcSeparator = format.getArcSeparator();
+    const bool outgoing = format.useOutgoingArcs();
+    long long currVertex = 0;
+    long long adjVertex;
+    while (currVertex < numVertices && nextRecord(begin, end)) {
+        // same tokens as getline would yield
+        while (begin != end) {
+            const char *sep = static_cast<const char*>(memchr(begin, arcSeparator, static_cast<size_t>(end - begin)));
+            const char *tokenEnd = sep ? sep : end;
+            if (!parseInt(begin, tokenEnd, &adjVertex, lastError)) {
+                graph->addArcs(arcs);
                 return false;
             }
             if (adjVertex < 0 || adjVertex >= numVertices) {
                 ostringstream stringStream;
                 stringStream << "Illegal adjacency " << adjVertex << ".";
-                grin->lastError = stringStream.str();
+                lastError = stringStream.str();
+                graph->addArcs(arcs);
                 return false;
             }
-            if (grin->format.useOutgoingArcs()) {
-                graph->addArc(vertices.at(currVertex), vertices.at(adjVertex));
+            if (outgoing) {
+                arcs.emplace_back(vertices[currVertex], vertices[adjVertex]);
             } else {
-                graph->addArc(vertices.at(adjVertex), vertices.at(currVertex));
+                arcs.emplace_back(vertices[adjVertex], vertices[currVertex]);
             }
+            begin = sep ? sep + 1 : end;
         }
         currVertex++;
     }
+    graph->addArcs(arcs);
 
     return true;
 
 }
 
-bool parseInt(std::string s, int *i, std::string &err) {
+bool parseInt(const char *begin, const char *end, long long *i, std::string &err) {
     using namespace std;
-    size_t pos;
-    try {
-        *i = stoi(s, &pos);
-    } catch (const logic_error &) {
+    // accept what stoi accepts: leading whitespace and an optional plus sign
+    const char *p = begin;
+    while (p != end && isspace(static_cast<unsigned char>(*p))) {
+        p++;
+    }
+    if (p != end && *p == '+' && p + 1 != end && isdigit(static_cast<unsigned char>(p[1]))) {
+        p++;
+    }
+    auto result = from_chars(p, end, *i);
+    if (result.ec != errc()) {
         ostringstream stringStream;
-        stringStream << s << " is not an integer.";
+        stringStream << string(begin, end) << " is not an integer.";
         err = stringStream.str();
         return false;
     }
-    if (pos < s.length()) {
+    if (result.ptr != end) {
         ostringstream stringStream;
-        stringStream << "Illegal character \"" << s.at(pos) << "\" found.";
+        stringStream << "Illegal character \"" << *result.ptr << "\" found.";
         err = stringStream.str();
         return false;
     }
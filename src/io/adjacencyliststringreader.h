@@ -25,20 +25,38 @@
 
 #include "streamdigraphreader.h"
 #include "adjacencyliststringformat.h"
+#include "graph/digraph.h"
+
+#include <limits>
+#include <string>
 
 namespace Algora {
 
 class AdjacencyListStringReader : public StreamDiGraphReader
 {
 public:
+    typedef DiGraph::size_type size_type;
+    // the largest vertex count the format accepted when it was parsed as int
+    static constexpr size_type DEFAULT_MAX_VERTICES = std::numeric_limits<int>::max();
+
     AdjacencyListStringReader(std::istream *input,
                               AdjacencyListStringFormat format = AdjacencyListStringFormat());
     virtual ~AdjacencyListStringReader() override;
 
     std::string getLastError() const;
+    // graphs with more vertices are rejected before any vertex is added
+    void setMaxVertices(size_type n);
+
+    // Reads from a memory-mapped file, or from an own file stream if the file cannot be mapped.
+    // Returns false if the file cannot be opened. A later call to setInputStream() takes precedence.
+    bool openFile(const std::string &fileName);
+    // Reads from the given buffer, which is not copied and must outlive the reader.
+    // A later call to setInputStream() takes precedence.
+    void setInputBuffer(const char *begin, const char *end);
 
     // DiGraphProvider interface
 public:
+    virtual bool isGraphAvailable() override;
     virtual bool provideDiGraph(DiGraph *graph) override;
 
 private:
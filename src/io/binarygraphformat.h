@@ -0,0 +1,71 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BINARYGRAPHFORMAT_H
+#define BINARYGRAPHFORMAT_H
+
+#include <cstdint>
+
+namespace Algora {
+
+/**
+ * Versioned binary CSR format. All integers are stored in native byte order;
+ * files written on a machine of different endianness are rejected.
+ *
+ *   header       BinaryGraphHeader
+ *   offsets      (numVertices + 1) x uint64, outgoing arcs of vertex i are offsets[i] to offsets[i + 1] - 1
+ *   heads        numArcs x uint64
+ *   weightMask   ceil(numArcs / 64) x uint64, if HasWeights; bit k % 64 of word k / 64 is set iff arc k is weighted
+ *   weights      numArcs x uint64, if HasWeights; weight of arc k if it is weighted, 0 otherwise
+ *   nameOffsets  (numVertices + 1) x uint64, if HasNames; offsets into the following characters
+ *   names        nameOffsets[numVertices] characters, padded with zeros to a multiple of 8
+ *
+ * A graph therefore always occupies a multiple of 8 bytes, and several graphs may follow each other.
+ */
+struct BinaryGraphHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t flags;
+    std::uint64_t numVertices;
+    std::uint64_t numArcs;
+    std::uint64_t reserved;
+
+    enum Flags : std::uint64_t {
+        HasWeights = 1U,
+        HasNames = 2U
+    };
+};
+
+static_assert(sizeof(BinaryGraphHeader) == 48, "unexpected padding in BinaryGraphHeader");
+
+constexpr std::uint64_t binaryGraphMaskWords(std::uint64_t numArcs) {
+    return numArcs / 64U + (numArcs % 64U != 0U ? 1U : 0U);
+}
+
+constexpr char BinaryGraphMagic[8] = { 'A', 'L', 'G', 'O', 'C', 'S', 'R', '\0' };
+constexpr std::uint32_t BinaryGraphVersion = 2U;
+constexpr std::uint32_t BinaryGraphByteOrderMark = 0x01020304U;
+
+}
+
+#endif // BINARYGRAPHFORMAT_H
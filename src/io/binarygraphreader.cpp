@@ -0,0 +1,240 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "binarygraphreader.h"
+#include "binarygraphformat.h"
+#include "binarygraphview.h"
+#include "mappedfile.h"
+
+#include "graph/digraph.h"
+#include "graph/weightedarc.h"
+#include "graph.static/staticdigraph.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace Algora {
+
+namespace {
+
+// appends count words, growing the storage only as far as the input reaches
+bool readWords(std::istream &input, std::vector<std::uint64_t> &storage, std::uint64_t count)
+{
+    const std::uint64_t piece = 1U << 20;
+    while (count > 0U) {
+        std::uint64_t n = std::min(count, piece);
+        size_t first = storage.size();
+        storage.resize(first + n);
+        if (!input.read(reinterpret_cast<char*>(storage.data() + first),
+                        static_cast<std::streamsize>(n * sizeof(std::uint64_t)))) {
+            return false;
+        }
+        count -= n;
+    }
+    return true;
+}
+
+}
+
+struct BinaryGraphReader::CheshireCat {
+    MappedFile mappedFile;
+    std::unique_ptr<std::ifstream> ownInput;
+    const char *bufferPos;
+    const char *bufferEnd;
+    std::vector<std::uint64_t> storage;
+    BinaryGraphView view;
+    std::string lastError;
+
+    CheshireCat() : bufferPos(nullptr), bufferEnd(nullptr) { }
+
+    bool readStream(std::istream &input);
+};
+
+bool BinaryGraphReader::CheshireCat::readStream(std::istream &input)
+{
+    static_assert(sizeof(BinaryGraphHeader) % sizeof(std::uint64_t) == 0U, "header must consist of words");
+    storage.clear();
+    if (!readWords(input, storage, sizeof(BinaryGraphHeader) / sizeof(std::uint64_t))) {
+        lastError = "Missing header.";
+        return false;
+    }
+    BinaryGraphHeader header;
+    std::memcpy(&header, storage.data(), sizeof(header));
+    if (!BinaryGraphView::checkHeader(header, lastError)) {
+        return false;
+    }
+    std::uint64_t words = header.numVertices + 1U + header.numArcs;
+    if (header.flags & BinaryGraphHeader::HasWeights) {
+        words += binaryGraphMaskWords(header.numArcs) + header.numArcs;
+    }
+    if (header.flags & BinaryGraphHeader::HasNames) {
+        words += header.numVertices + 1U;
+    }
+    if (!readWords(input, storage, words)) {
+        lastError = "Truncated graph.";
+        return false;
+    }
+    if (header.flags & BinaryGraphHeader::HasNames) {
+        std::uint64_t nameBytes = storage.back();
+        if (!readWords(input, storage, (nameBytes + 7U) / 8U)) {
+            lastError = "Truncated graph.";
+            return false;
+        }
+    }
+    const char *begin = reinterpret_cast<const char*>(storage.data());
+    if (!view.assign(begin, begin + storage.size() * sizeof(std::uint64_t))) {
+        lastError = view.getLastError();
+        return false;
+    }
+    return true;
+}
+
+BinaryGraphReader::BinaryGraphReader(std::istream *input)
+    : StreamDiGraphReader(input), grin(new CheshireCat)
+{
+
+}
+
+BinaryGraphReader::~BinaryGraphReader()
+{
+    delete grin;
+}
+
+bool BinaryGraphReader::openFile(const std::string &fileName)
+{
+    StreamDiGraphReader::inputStream = nullptr;
+    grin->ownInput.reset();
+    grin->bufferPos = grin->bufferEnd = nullptr;
+    if (grin->mappedFile.open(fileName)) {
+        grin->bufferPos = grin->mappedFile.begin();
+        grin->bufferEnd = grin->mappedFile.end();
+        return true;
+    }
+    grin->ownInput.reset(new std::ifstream(fileName, std::ios::binary));
+    if (!grin->ownInput->is_open()) {
+        grin->ownInput.reset();
+        grin->lastError = "Failed to open " + fileName;
+        return false;
+    }
+    StreamDiGraphReader::inputStream = grin->ownInput.get();
+    return true;
+}
+
+void BinaryGraphReader::setInputBuffer(const char *begin, const char *end)
+{
+    StreamDiGraphReader::inputStream = nullptr;
+    grin->ownInput.reset();
+    grin->mappedFile.close();
+    grin->bufferPos = begin;
+    grin->bufferEnd = end;
+}
+
+std::string BinaryGraphReader::getLastError() const
+{
+    return grin->lastError;
+}
+
+bool BinaryGraphReader::isGraphAvailable()
+{
+    if (StreamDiGraphReader::inputStream != nullptr) {
+        return StreamDiGraphReader::isGraphAvailable();
+    }
+    return grin->bufferPos != grin->bufferEnd;
+}
+
+bool BinaryGraphReader::provideDiGraph(DiGraph *graph)
+{
+    BinaryGraphView &view = grin->view;
+    if (StreamDiGraphReader::inputStream != nullptr) {
+        if (!grin->readStream(*StreamDiGraphReader::inputStream)) {
+            return false;
+        }
+    } else {
+        if (!view.assign(grin->bufferPos, grin->bufferEnd)) {
+            grin->lastError = view.getLastError();
+            return false;
+        }
+        grin->bufferPos += view.getByteSize();
+    }
+
+    typedef BinaryGraphView::size_type size_type;
+    StaticDiGraph *staticGraph = dynamic_cast<StaticDiGraph*>(graph);
+    if (staticGraph) {
+        staticGraph->assign(view.getSize(), view.getOffsets(), view.getHeads(),
+                            view.getWeightMask(), view.getWeights());
+        if (view.hasNames()) {
+            for (size_type i = 0U; i < view.getSize(); i++) {
+                auto name = view.nameOf(i);
+                if (!name.empty()) {
+                    staticGraph->vertexAt(i)->setName(std::string(name));
+                }
+            }
+        }
+        view.close();
+        std::vector<std::uint64_t>().swap(grin->storage);
+        return true;
+    }
+
+    DiGraph::UpdateBatch batch(graph);
+    std::vector<Vertex*> vertices;
+    graph->addVertices(view.getSize(), &vertices);
+    if (view.hasNames()) {
+        for (size_type i = 0U; i < view.getSize(); i++) {
+            auto name = view.nameOf(i);
+            if (!name.empty()) {
+                vertices[i]->setName(std::string(name));
+            }
+        }
+    }
+    // simple arcs are added in bulk up to the next weighted arc to keep the order of the file
+    std::vector<DiGraph::ArcEndpoints> arcs;
+    arcs.reserve(view.getNumArcs());
+    for (size_type i = 0U; i < view.getSize(); i++) {
+        view.forEachOutgoing(i, [&](size_type head, size_type k) {
+            if (!view.isWeightedArcAt(k)) {
+                arcs.emplace_back(vertices[i], vertices[head]);
+                return;
+            }
+            if (!arcs.empty()) {
+                graph->addArcs(arcs);
+                arcs.clear();
+            }
+            size_type weight = view.weightAt(k);
+            MultiArc *a = graph->addMultiArc(vertices[i], vertices[head], weight > 0U ? weight : 1U);
+            if (weight == 0U) {
+                WeightedArc *wa = dynamic_cast<WeightedArc*>(a);
+                if (wa) {
+                    wa->setWeight(0U);
+                }
+            }
+        });
+    }
+    graph->addArcs(arcs);
+    view.close();
+    std::vector<std::uint64_t>().swap(grin->storage);
+    return true;
+}
+
+}
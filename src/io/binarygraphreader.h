@@ -0,0 +1,67 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BINARYGRAPHREADER_H
+#define BINARYGRAPHREADER_H
+
+#include "streamdigraphreader.h"
+
+#include <string>
+
+namespace Algora {
+
+/**
+ * Reads graphs in the binary CSR format described in binarygraphformat.h into a DiGraph.
+ * Arcs are added in the order of the file, weighted arcs as WeightedArc, consecutive simple arcs in bulk.
+ * A StaticDiGraph is instead replaced by the graph and built directly from the CSR sections.
+ * Input streams should be opened in binary mode.
+ * To access a file without constructing a DiGraph, see BinaryGraphView.
+ */
+class BinaryGraphReader : public StreamDiGraphReader
+{
+public:
+    explicit BinaryGraphReader(std::istream *input = nullptr);
+    virtual ~BinaryGraphReader() override;
+
+    BinaryGraphReader(const BinaryGraphReader &other) = delete;
+    BinaryGraphReader &operator=(const BinaryGraphReader &other) = delete;
+
+    // Returns false if the file cannot be opened. A later call to setInputStream() takes precedence.
+    bool openFile(const std::string &fileName);
+    // The buffer must be 8-byte aligned and outlive the reader. A later call to setInputStream() takes precedence.
+    void setInputBuffer(const char *begin, const char *end);
+
+    std::string getLastError() const;
+
+    // DiGraphProvider interface
+public:
+    virtual bool isGraphAvailable() override;
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    struct CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // BINARYGRAPHREADER_H
@@ -0,0 +1,207 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "binarygraphview.h"
+#include "binarygraphformat.h"
+#include "mappedfile.h"
+
+#include <cstring>
+#include <sstream>
+
+namespace Algora {
+
+struct BinaryGraphView::CheshireCat {
+    MappedFile mappedFile;
+    std::string lastError;
+};
+
+BinaryGraphView::BinaryGraphView()
+    : grin(new CheshireCat), numVertices(0U), numArcs(0U), byteSize(0U),
+      offsets(nullptr), heads(nullptr), weightMask(nullptr), weights(nullptr), nameOffsets(nullptr), names(nullptr)
+{
+
+}
+
+BinaryGraphView::~BinaryGraphView()
+{
+    delete grin;
+}
+
+bool BinaryGraphView::openFile(const std::string &fileName)
+{
+    close();
+    if (!grin->mappedFile.open(fileName)) {
+        grin->lastError = "Failed to map " + fileName;
+        return false;
+    }
+    if (!assign(grin->mappedFile.begin(), grin->mappedFile.end())) {
+        grin->mappedFile.close();
+        return false;
+    }
+    return true;
+}
+
+bool BinaryGraphView::assign(const char *begin, const char *end)
+{
+    reset();
+
+    std::string &error = grin->lastError;
+    size_type available = static_cast<size_type>(end - begin);
+    if (reinterpret_cast<std::uintptr_t>(begin) % alignof(std::uint64_t) != 0U) {
+        error = "Buffer is not 8-byte aligned.";
+        return false;
+    }
+    BinaryGraphHeader header;
+    if (available < sizeof(header)) {
+        error = "Missing header.";
+        return false;
+    }
+    std::memcpy(&header, begin, sizeof(header));
+    if (!checkHeader(header, error)) {
+        return false;
+    }
+
+    // sizes in words, checked against the buffer before any multiplication can overflow
+    size_type words = (available - sizeof(header)) / sizeof(std::uint64_t);
+    const std::uint64_t *data = reinterpret_cast<const std::uint64_t*>(begin + sizeof(header));
+    size_type needed = 0U;
+    auto take = [&](size_type n) -> const std::uint64_t* {
+        if (n > words - needed) {
+            return nullptr;
+        }
+        const std::uint64_t *section = data + needed;
+        needed += n;
+        return section;
+    };
+    bool ok = header.numVertices < words && header.numArcs <= words;
+    const std::uint64_t *offsetSection = ok ? take(header.numVertices + 1U) : nullptr;
+    const std::uint64_t *headSection = offsetSection ? take(header.numArcs) : nullptr;
+    const std::uint64_t *maskSection = nullptr;
+    const std::uint64_t *weightSection = nullptr;
+    const std::uint64_t *nameOffsetSection = nullptr;
+    ok = headSection != nullptr;
+    if (ok && (header.flags & BinaryGraphHeader::HasWeights)) {
+        maskSection = take(binaryGraphMaskWords(header.numArcs));
+        weightSection = maskSection ? take(header.numArcs) : nullptr;
+        ok = weightSection != nullptr;
+    }
+    if (ok && (header.flags & BinaryGraphHeader::HasNames)) {
+        nameOffsetSection = take(header.numVertices + 1U);
+        ok = nameOffsetSection != nullptr && nameOffsetSection[header.numVertices] <= (words - needed) * 8U
+                && take((nameOffsetSection[header.numVertices] + 7U) / 8U) != nullptr;
+    }
+    if (!ok) {
+        error = "Truncated graph.";
+        return false;
+    }
+
+    // validate the structure once so that accessors need no checks
+    if (offsetSection[0] != 0U || offsetSection[header.numVertices] != header.numArcs) {
+        error = "Inconsistent offsets.";
+        return false;
+    }
+    for (size_type i = 0U; i < header.numVertices; i++) {
+        if (offsetSection[i] > offsetSection[i + 1U]) {
+            error = "Inconsistent offsets.";
+            return false;
+        }
+    }
+    for (size_type k = 0U; k < header.numArcs; k++) {
+        if (headSection[k] >= header.numVertices) {
+            error = "Arc head out of range.";
+            return false;
+        }
+    }
+    if (maskSection && header.numArcs % 64U != 0U
+            && (maskSection[header.numArcs / 64U] >> (header.numArcs % 64U)) != 0U) {
+        error = "Weight mask out of range.";
+        return false;
+    }
+    if (nameOffsetSection) {
+        if (nameOffsetSection[0] != 0U) {
+            error = "Inconsistent name offsets.";
+            return false;
+        }
+        for (size_type i = 0U; i < header.numVertices; i++) {
+            if (nameOffsetSection[i] > nameOffsetSection[i + 1U]) {
+                error = "Inconsistent name offsets.";
+                return false;
+            }
+        }
+    }
+
+    numVertices = header.numVertices;
+    numArcs = header.numArcs;
+    byteSize = sizeof(header) + needed * sizeof(std::uint64_t);
+    offsets = offsetSection;
+    heads = headSection;
+    weightMask = maskSection;
+    weights = weightSection;
+    nameOffsets = nameOffsetSection;
+    names = nameOffsets ? reinterpret_cast<const char*>(nameOffsets + numVertices + 1U) : nullptr;
+    error.clear();
+    return true;
+}
+
+void BinaryGraphView::close()
+{
+    reset();
+    grin->mappedFile.close();
+    grin->lastError.clear();
+}
+
+bool BinaryGraphView::checkHeader(const BinaryGraphHeader &header, std::string &error)
+{
+    if (std::memcmp(header.magic, BinaryGraphMagic, sizeof(header.magic)) != 0) {
+        error = "Not a binary graph.";
+        return false;
+    }
+    if (header.byteOrderMark != BinaryGraphByteOrderMark) {
+        error = "Byte order differs from this machine.";
+        return false;
+    }
+    if (header.version != BinaryGraphVersion) {
+        std::ostringstream stringStream;
+        stringStream << "Unsupported version " << header.version << ".";
+        error = stringStream.str();
+        return false;
+    }
+    if ((header.flags & ~std::uint64_t(BinaryGraphHeader::HasWeights | BinaryGraphHeader::HasNames)) != 0U) {
+        error = "Unknown flags.";
+        return false;
+    }
+    return true;
+}
+
+void BinaryGraphView::reset()
+{
+    numVertices = numArcs = byteSize = 0U;
+    offsets = heads = weightMask = weights = nameOffsets = nullptr;
+    names = nullptr;
+}
+
+std::string BinaryGraphView::getLastError() const
+{
+    return grin->lastError;
+}
+
+}
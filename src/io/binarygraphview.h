@@ -0,0 +1,139 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BINARYGRAPHVIEW_H
+#define BINARYGRAPHVIEW_H
+
+#include "graph/digraph.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Algora {
+
+struct BinaryGraphHeader;
+
+/**
+ * Read-only access to a graph in the binary CSR format (see binarygraphformat.h)
+ * directly on the file contents, without constructing any vertex or arc objects.
+ * Vertices are the indices 0, ..., getSize() - 1 and arcs the positions
+ * 0, ..., getNumArcs() - 1 in the order of their tails, as in StaticDiGraph.
+ * Use BinaryGraphReader to obtain a DiGraph instead; read into a StaticDiGraph,
+ * no intermediate graph is built.
+ */
+class BinaryGraphView
+{
+public:
+    typedef DiGraph::size_type size_type;
+
+    BinaryGraphView();
+    ~BinaryGraphView();
+
+    BinaryGraphView(const BinaryGraphView &other) = delete;
+    BinaryGraphView &operator=(const BinaryGraphView &other) = delete;
+
+    // Maps the first graph of the file; returns false if it cannot be opened or is malformed.
+    bool openFile(const std::string &fileName);
+    // Views the first graph in the buffer, which must be 8-byte aligned and outlive the view.
+    bool assign(const char *begin, const char *end);
+    void close();
+
+    bool isValid() const { return offsets != nullptr; }
+    std::string getLastError() const;
+    // number of bytes occupied by the graph
+    size_type getByteSize() const { return byteSize; }
+
+    size_type getSize() const { return numVertices; }
+    size_type getNumArcs() const { return numArcs; }
+
+    size_type outBegin(size_type i) const { return offsets[i]; }
+    size_type outEnd(size_type i) const { return offsets[i + 1]; }
+    size_type getOutDegree(size_type i) const { return offsets[i + 1] - offsets[i]; }
+    size_type headIndexAt(size_type k) const { return heads[k]; }
+
+    bool hasWeights() const { return weights != nullptr; }
+    bool isWeightedArcAt(size_type k) const {
+        return weightMask && ((weightMask[k / 64U] >> (k % 64U)) & 1U);
+    }
+    // weight of a weighted arc, which may be 0, and 1 for simple arcs
+    size_type weightAt(size_type k) const { return isWeightedArcAt(k) ? weights[k] : 1U; }
+
+    bool hasNames() const { return nameOffsets != nullptr; }
+    std::string_view nameOf(size_type i) const {
+        if (!nameOffsets) {
+            return std::string_view();
+        }
+        return std::string_view(names + nameOffsets[i], nameOffsets[i + 1] - nameOffsets[i]);
+    }
+
+    // raw sections as described in binarygraphformat.h; weight sections are nullptr without weights
+    const std::uint64_t *getOffsets() const { return offsets; }
+    const std::uint64_t *getHeads() const { return heads; }
+    const std::uint64_t *getWeightMask() const { return weightMask; }
+    const std::uint64_t *getWeights() const { return weights; }
+
+    // checks magic, byte order, version and flags
+    static bool checkHeader(const BinaryGraphHeader &header, std::string &error);
+
+    // calls f(headIndex, arcIndex); f may return false to stop early
+    template<typename F>
+    bool forEachOutgoing(size_type i, F &&f) const {
+        for (size_type k = outBegin(i); k < outEnd(i); k++) {
+            if (!invokeAndContinue(f, heads[k], k)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    struct CheshireCat;
+    CheshireCat *grin;
+
+    size_type numVertices;
+    size_type numArcs;
+    size_type byteSize;
+    const std::uint64_t *offsets;
+    const std::uint64_t *heads;
+    const std::uint64_t *weightMask;
+    const std::uint64_t *weights;
+    const std::uint64_t *nameOffsets;
+    const char *names;
+
+    void reset();
+
+    template<typename F>
+    static bool invokeAndContinue(F &f, size_type head, size_type k) {
+        if constexpr (std::is_same<typename std::invoke_result<F&, size_type, size_type>::type, bool>::value) {
+            return f(head, k);
+        } else {
+            f(head, k);
+            return true;
+        }
+    }
+};
+
+}
+
+#endif // BINARYGRAPHVIEW_H
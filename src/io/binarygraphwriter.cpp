@@ -0,0 +1,150 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "binarygraphwriter.h"
+#include "binarygraphformat.h"
+
+#include "graph/digraph.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "pipe/digraphinfo.h"
+#include "algorithm/digraphdispatch.h"
+
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Algora {
+
+namespace {
+
+void writeWords(std::ostream &out, const std::vector<std::uint64_t> &words)
+{
+    out.write(reinterpret_cast<const char*>(words.data()),
+              static_cast<std::streamsize>(words.size() * sizeof(std::uint64_t)));
+}
+
+}
+
+BinaryGraphWriter::BinaryGraphWriter(std::ostream *output)
+    : StreamDiGraphWriter(output)
+{
+
+}
+
+BinaryGraphWriter::~BinaryGraphWriter()
+{
+
+}
+
+void BinaryGraphWriter::processGraph(const DiGraph *graph, const DiGraphInfo *info)
+{
+    if (StreamDiGraphWriter::outputStream == nullptr) {
+        return;
+    }
+    std::ostream &outputStream = *(StreamDiGraphWriter::outputStream);
+    DiGraph *ncGraph = const_cast<DiGraph*>(graph);
+
+    DiGraphInfo defaultInfo(ncGraph);
+    if (!info) {
+        info = &defaultInfo;
+    }
+
+    std::vector<Vertex*> vertices;
+    vertices.reserve(ncGraph->getSize());
+    info->mapVertices([&](Vertex *v) { vertices.push_back(v); });
+
+    std::unique_ptr<ModifiableProperty<std::uint64_t>> vertexIndexPtr;
+    if (hasCompactVertexIds(ncGraph)) {
+        vertexIndexPtr.reset(new FastPropertyMap<std::uint64_t>(0U));
+    } else {
+        vertexIndexPtr.reset(new PropertyMap<std::uint64_t>(0U));
+    }
+    ModifiableProperty<std::uint64_t> &vertexIndex = *vertexIndexPtr;
+    bool hasNames = false;
+    for (std::uint64_t i = 0U; i < vertices.size(); i++) {
+        vertexIndex.setValue(vertices[i], i);
+        hasNames |= vertices[i]->hasName();
+    }
+
+    std::vector<std::uint64_t> offsets;
+    offsets.reserve(vertices.size() + 1U);
+    std::vector<std::uint64_t> heads;
+    heads.reserve(ncGraph->getNumArcs(true));
+    std::vector<std::uint64_t> weightMask;
+    std::vector<std::uint64_t> weights;
+    bool hasWeights = false;
+    for (Vertex *v : vertices) {
+        offsets.push_back(heads.size());
+        info->mapOutgoingArcs(v, [&](Arc *a) {
+            std::uint64_t k = heads.size();
+            heads.push_back(vertexIndex(a->getHead()));
+            MultiArc *ma = dynamic_cast<MultiArc*>(a);
+            if (ma && !hasWeights) {
+                hasWeights = true;
+                weights.resize(k, 0U);
+            }
+            if (hasWeights) {
+                weights.push_back(ma ? ma->getSize() : 0U);
+            }
+            if (ma) {
+                weightMask.resize(binaryGraphMaskWords(k + 1U), 0U);
+                weightMask[k / 64U] |= std::uint64_t(1U) << (k % 64U);
+            }
+        });
+    }
+    offsets.push_back(heads.size());
+    weightMask.resize(hasWeights ? binaryGraphMaskWords(heads.size()) : 0U, 0U);
+
+    BinaryGraphHeader header;
+    std::memcpy(header.magic, BinaryGraphMagic, sizeof(header.magic));
+    header.version = BinaryGraphVersion;
+    header.byteOrderMark = BinaryGraphByteOrderMark;
+    header.flags = (hasWeights ? std::uint64_t(BinaryGraphHeader::HasWeights) : 0U)
+            | (hasNames ? std::uint64_t(BinaryGraphHeader::HasNames) : 0U);
+    header.numVertices = vertices.size();
+    header.numArcs = heads.size();
+    header.reserved = 0U;
+    outputStream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeWords(outputStream, offsets);
+    writeWords(outputStream, heads);
+    if (hasWeights) {
+        writeWords(outputStream, weightMask);
+        writeWords(outputStream, weights);
+    }
+    if (hasNames) {
+        std::string names;
+        offsets.clear();
+        for (Vertex *v : vertices) {
+            offsets.push_back(names.size());
+            names.append(v->getName());
+        }
+        offsets.push_back(names.size());
+        names.resize((names.size() + 7U) / 8U * 8U, '\0');
+        writeWords(outputStream, offsets);
+        outputStream.write(names.data(), static_cast<std::streamsize>(names.size()));
+    }
+}
+
+}
@@ -0,0 +1,49 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BINARYGRAPHWRITER_H
+#define BINARYGRAPHWRITER_H
+
+#include "streamdigraphwriter.h"
+
+namespace Algora {
+
+/**
+ * Writes graphs in the binary CSR format described in binarygraphformat.h.
+ * Weights are written if the graph contains a MultiArc (e.g., a WeightedArc),
+ * names if any vertex is named.
+ * The output stream should be opened in binary mode; flushing it is left to the caller.
+ */
+class BinaryGraphWriter : public StreamDiGraphWriter
+{
+public:
+    explicit BinaryGraphWriter(std::ostream *output = nullptr);
+    virtual ~BinaryGraphWriter() override;
+
+    // DiGraphProcessor interface
+public:
+    virtual void processGraph(const DiGraph *graph, const DiGraphInfo *info = nullptr) override;
+};
+
+}
+
+#endif // BINARYGRAPHWRITER_H
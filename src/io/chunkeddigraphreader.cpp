@@ -0,0 +1,356 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "chunkeddigraphreader.h"
+#include "mappedfile.h"
+
+#include "parallel/threadpool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <sstream>
+
+namespace Algora {
+
+constexpr ChunkedDiGraphReader::size_type ChunkedDiGraphReader::DEFAULT_MAX_VERTICES;
+
+struct ChunkedDiGraphReader::CheshireCat {
+    MappedFile mappedFile;
+    std::unique_ptr<std::ifstream> ownInput;
+    const char *bufferBegin;
+    const char *bufferEnd;
+    bool hasBuffer;
+    std::string streamContents;
+
+    size_type chunkSize;
+    size_type maxVertices;
+    std::string lastError;
+
+    unsigned numThreads;
+    ThreadPool *pool;
+    std::unique_ptr<ThreadPool> ownPool;
+
+    CheshireCat()
+        : bufferBegin(nullptr), bufferEnd(nullptr), hasBuffer(false), chunkSize(1U << 22),
+          maxVertices(DEFAULT_MAX_VERTICES), numThreads(0U), pool(nullptr) { }
+
+    ThreadPool &threadPool() {
+        if (pool) {
+            return *pool;
+        }
+        if (!ownPool) {
+            ownPool.reset(new ThreadPool(numThreads));
+        }
+        return *ownPool;
+    }
+
+    void readStream(std::istream &input) {
+        streamContents.clear();
+        std::vector<char> block(1U << 20);
+        while (input.read(block.data(), static_cast<std::streamsize>(block.size())) || input.gcount() > 0) {
+            streamContents.append(block.data(), static_cast<size_t>(input.gcount()));
+        }
+    }
+
+    // calls f(i) for each i in [0, num) on all threads
+    template<typename F>
+    void forEach(size_type num, const F &f) {
+        if (num <= 1U) {
+            for (size_type i = 0U; i < num; i++) {
+                f(i);
+            }
+            return;
+        }
+        std::atomic<size_type> next(0U);
+        threadPool().run([&](unsigned) {
+            for (size_type i = next++; i < num; i = next++) {
+                f(i);
+            }
+        });
+    }
+};
+
+ChunkedDiGraphReader::ChunkedDiGraphReader(std::istream *input)
+    : StreamDiGraphReader(input), grin(new CheshireCat)
+{
+
+}
+
+ChunkedDiGraphReader::~ChunkedDiGraphReader()
+{
+    delete grin;
+}
+
+bool ChunkedDiGraphReader::openFile(const std::string &fileName)
+{
+    StreamDiGraphReader::inputStream = nullptr;
+    grin->ownInput.reset();
+    grin->bufferBegin = grin->bufferEnd = nullptr;
+    grin->hasBuffer = false;
+    if (grin->mappedFile.open(fileName)) {
+        grin->bufferBegin = grin->mappedFile.begin();
+        grin->bufferEnd = grin->mappedFile.end();
+        grin->hasBuffer = true;
+        return true;
+    }
+    grin->ownInput.reset(new std::ifstream(fileName, std::ios::binary));
+    if (!grin->ownInput->is_open()) {
+        grin->ownInput.reset();
+        grin->lastError = "Failed to open " + fileName;
+        return false;
+    }
+    StreamDiGraphReader::inputStream = grin->ownInput.get();
+    return true;
+}
+
+void ChunkedDiGraphReader::setInputBuffer(const char *begin, const char *end)
+{
+    StreamDiGraphReader::inputStream = nullptr;
+    grin->ownInput.reset();
+    grin->mappedFile.close();
+    grin->bufferBegin = begin;
+    grin->bufferEnd = end;
+    grin->hasBuffer = true;
+}
+
+void ChunkedDiGraphReader::setNumThreads(unsigned n)
+{
+    grin->numThreads = n;
+    grin->ownPool.reset();
+}
+
+void ChunkedDiGraphReader::useThreadPool(ThreadPool *threadPool)
+{
+    grin->pool = threadPool;
+}
+
+void ChunkedDiGraphReader::setChunkSize(size_type bytes)
+{
+    grin->chunkSize = bytes > 0U ? bytes : 1U;
+}
+
+void ChunkedDiGraphReader::setMaxVertices(size_type n)
+{
+    grin->maxVertices = n;
+}
+
+ChunkedDiGraphReader::size_type ChunkedDiGraphReader::getMaxVertices() const
+{
+    return grin->maxVertices;
+}
+
+std::string ChunkedDiGraphReader::getLastError() const
+{
+    return grin->lastError;
+}
+
+bool ChunkedDiGraphReader::isGraphAvailable()
+{
+    if (StreamDiGraphReader::inputStream != nullptr) {
+        return StreamDiGraphReader::isGraphAvailable();
+    }
+    return grin->hasBuffer && grin->bufferBegin != grin->bufferEnd;
+}
+
+bool ChunkedDiGraphReader::provideDiGraph(DiGraph *graph)
+{
+    typedef std::chrono::steady_clock clock;
+    auto start = clock::now();
+
+    const char *begin, *end;
+    if (StreamDiGraphReader::inputStream != nullptr) {
+        grin->readStream(*StreamDiGraphReader::inputStream);
+        begin = grin->streamContents.data();
+        end = begin + grin->streamContents.size();
+    } else if (grin->hasBuffer) {
+        begin = grin->bufferBegin;
+        end = grin->bufferEnd;
+        grin->bufferBegin = grin->bufferEnd;
+        grin->hasBuffer = false;
+    } else {
+        grin->lastError = "No input.";
+        return false;
+    }
+
+    std::string &error = grin->lastError;
+    error.clear();
+    const char *data = parseHeader(begin, end, error);
+    if (data == nullptr) {
+        return false;
+    }
+
+    // split into newline-aligned chunks
+    struct Chunk {
+        const char *begin;
+        const char *end;
+        size_type firstLine = 0U;
+        size_type numLines = 0U;
+        size_type maxIndex = 0U;
+        std::vector<IndexPair> arcs;
+        std::string error;
+    };
+    std::vector<Chunk> chunks;
+    for (const char *pos = data; pos != end; ) {
+        Chunk chunk;
+        chunk.begin = pos;
+        if (static_cast<size_type>(end - pos) <= grin->chunkSize) {
+            pos = end;
+        } else {
+            const char *p = pos + grin->chunkSize;
+            const char *nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            pos = nl ? nl + 1 : end;
+        }
+        chunk.end = pos;
+        chunks.push_back(std::move(chunk));
+    }
+
+    if (needsLineNumbers()) {
+        grin->forEach(chunks.size(), [&](size_type i) {
+            size_type count = 0U;
+            const char *pos = chunks[i].begin, *lineBegin, *lineEnd;
+            while (nextLine(pos, chunks[i].end, lineBegin, lineEnd)) {
+                if (isDataLine(lineBegin, lineEnd)) {
+                    count++;
+                }
+            }
+            chunks[i].numLines = count;
+        });
+        size_type line = 0U;
+        for (Chunk &chunk : chunks) {
+            chunk.firstLine = line;
+            line += chunk.numLines;
+        }
+    }
+
+    grin->forEach(chunks.size(), [&](size_type i) {
+        Chunk &chunk = chunks[i];
+        if (!parseChunk(chunk.begin, chunk.end, chunk.firstLine, chunk.arcs, chunk.numLines, chunk.error)) {
+            if (chunk.error.empty()) {
+                chunk.error = "Parse error.";
+            }
+            return;
+        }
+        size_type maxIndex = 0U;
+        for (const IndexPair &arc : chunk.arcs) {
+            if (arc.first >= maxIndex) {
+                maxIndex = arc.first + 1U;
+            }
+            if (arc.second >= maxIndex) {
+                maxIndex = arc.second + 1U;
+            }
+        }
+        chunk.maxIndex = maxIndex;
+    });
+
+    size_type numLines = 0U;
+    size_type numArcs = 0U;
+    size_type maxIndex = 0U;
+    for (Chunk &chunk : chunks) {
+        if (!chunk.error.empty()) {
+            error = chunk.error;
+            return false;
+        }
+        numLines += chunk.numLines;
+        numArcs += chunk.arcs.size();
+        if (chunk.maxIndex > maxIndex) {
+            maxIndex = chunk.maxIndex;
+        }
+    }
+    size_type numVertices = 0U;
+    if (!finish(numLines, numArcs, maxIndex, numVertices, error)) {
+        return false;
+    }
+    if (maxIndex > numVertices) {
+        error = "Arc endpoint out of range.";
+        return false;
+    }
+    if (numVertices > grin->maxVertices) {
+        std::ostringstream stringStream;
+        stringStream << "Graph has " << numVertices << " vertices, at most " << grin->maxVertices << " are accepted.";
+        error = stringStream.str();
+        return false;
+    }
+
+    auto parsed = clock::now();
+    double bytes = static_cast<double>(end - begin);
+    if (progressStream) {
+        double s = std::chrono::duration<double>(parsed - start).count();
+        *progressStream << "Parsed " << bytes / 1e6 << " MB and " << numArcs << " arcs in "
+                        << s << "s (" << bytes / 1e6 / s << " MB/s, " << numArcs / s << " arcs/s)." << std::endl;
+    }
+
+    DiGraph::UpdateBatch batch(graph);
+    std::vector<Vertex*> vertices;
+    graph->addVertices(numVertices, &vertices);
+    std::vector<DiGraph::ArcEndpoints> endpoints(numArcs);
+    std::vector<size_type> offsets(chunks.size() + 1U, 0U);
+    for (size_type i = 0U; i < chunks.size(); i++) {
+        offsets[i + 1U] = offsets[i] + chunks[i].arcs.size();
+    }
+    grin->forEach(chunks.size(), [&](size_type i) {
+        size_type k = offsets[i];
+        for (const IndexPair &arc : chunks[i].arcs) {
+            endpoints[k++] = DiGraph::ArcEndpoints(vertices[arc.first], vertices[arc.second]);
+        }
+        std::vector<IndexPair>().swap(chunks[i].arcs);
+    });
+    graph->addArcs(endpoints);
+
+    if (progressStream) {
+        auto built = clock::now();
+        double s = std::chrono::duration<double>(built - parsed).count();
+        double total = std::chrono::duration<double>(built - start).count();
+        *progressStream << "Constructed graph with " << numVertices << " vertices and " << numArcs << " arcs in "
+                        << s << "s (" << numArcs / s << " arcs/s); " << bytes / 1e6 / total << " MB/s overall." << std::endl;
+    }
+    return true;
+}
+
+bool ChunkedDiGraphReader::nextLine(const char *&pos, const char *end, const char *&lineBegin, const char *&lineEnd)
+{
+    if (pos == end) {
+        return false;
+    }
+    lineBegin = pos;
+    lineEnd = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+    if (lineEnd) {
+        pos = lineEnd + 1;
+    } else {
+        lineEnd = end;
+        pos = end;
+    }
+    if (lineEnd != lineBegin && *(lineEnd - 1) == '\r') {
+        lineEnd--;
+    }
+    return true;
+}
+
+std::string ChunkedDiGraphReader::illegalLine(const char *lineBegin, const char *lineEnd)
+{
+    return "Illegal line \"" + std::string(lineBegin, lineEnd) + "\".";
+}
+
+}
@@ -0,0 +1,144 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef CHUNKEDDIGRAPHREADER_H
+#define CHUNKEDDIGRAPHREADER_H
+
+#include "streamdigraphreader.h"
+#include "graph/digraph.h"
+
+#include <charconv>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Algora {
+
+class ThreadPool;
+
+/**
+ * Base class for readers of large line-based graph files.
+ * The input is split into newline-aligned chunks that are parsed in parallel,
+ * and all arcs are then added to the graph at once.
+ * Regular files passed to openFile() are memory-mapped; streams are read completely first.
+ * The whole input forms one graph. If it is malformed or has more than getMaxVertices() vertices,
+ * the graph is left unchanged and getLastError() describes the first error.
+ * If a progress stream is set, the throughput of parsing and construction is reported.
+ */
+class ChunkedDiGraphReader : public StreamDiGraphReader
+{
+public:
+    typedef DiGraph::size_type size_type;
+    static constexpr size_type DEFAULT_MAX_VERTICES = size_type(1U) << 32;
+
+    explicit ChunkedDiGraphReader(std::istream *input = nullptr);
+    virtual ~ChunkedDiGraphReader() override;
+
+    ChunkedDiGraphReader(const ChunkedDiGraphReader &other) = delete;
+    ChunkedDiGraphReader &operator=(const ChunkedDiGraphReader &other) = delete;
+
+    // Returns false if the file cannot be opened. A later call to setInputStream() takes precedence.
+    bool openFile(const std::string &fileName);
+    // The buffer is not copied and must outlive the reader. A later call to setInputStream() takes precedence.
+    void setInputBuffer(const char *begin, const char *end);
+
+    // 0 uses all hardware threads
+    void setNumThreads(unsigned n);
+    // use an external pool instead of an own one; nullptr reverts to an own pool
+    void useThreadPool(ThreadPool *threadPool);
+    // approximate number of bytes parsed by a thread at once
+    void setChunkSize(size_type bytes);
+    // graphs with more vertices are rejected before any vertex is added
+    void setMaxVertices(size_type n);
+
+    std::string getLastError() const;
+
+    // DiGraphProvider interface
+public:
+    virtual bool isGraphAvailable() override;
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+protected:
+    // zero-based tail and head index
+    typedef std::pair<size_type, size_type> IndexPair;
+
+    size_type getMaxVertices() const;
+
+    // Parses everything before the first data line and returns its position,
+    // or nullptr after setting error.
+    virtual const char *parseHeader(const char *begin, const char *end, std::string &error) = 0;
+    // Parses the complete lines in [begin, end). firstLine is the number of data lines
+    // before the chunk if needsLineNumbers(), and 0 otherwise.
+    // Must be thread-safe. numLines receives the number of data lines in the chunk.
+    virtual bool parseChunk(const char *begin, const char *end, size_type firstLine,
+                            std::vector<IndexPair> &arcs, size_type &numLines, std::string &error) const = 0;
+    // Checks the totals and determines the number of vertices; maxIndex is one more
+    // than the largest index of any arc.
+    virtual bool finish(size_type numLines, size_type numArcs, size_type maxIndex,
+                        size_type &numVertices, std::string &error) = 0;
+
+    // whether parseChunk() needs to know the number of preceding data lines
+    virtual bool needsLineNumbers() const { return false; }
+    // used for counting lines if needsLineNumbers()
+    virtual bool isDataLine(const char *begin, const char *end) const { return begin != end; }
+
+    static bool isBlank(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+    static const char *skipBlanks(const char *pos, const char *end) {
+        while (pos != end && isBlank(*pos)) {
+            pos++;
+        }
+        return pos;
+    }
+    // parses an unsigned integer that is followed by a blank or the end
+    static bool parseIndex(const char *&pos, const char *end, size_type &value) {
+        pos = skipBlanks(pos, end);
+        auto result = std::from_chars(pos, end, value);
+        if (result.ec != std::errc() || (result.ptr != end && !isBlank(*result.ptr))) {
+            return false;
+        }
+        pos = result.ptr;
+        return true;
+    }
+    static bool skipToken(const char *&pos, const char *end) {
+        pos = skipBlanks(pos, end);
+        if (pos == end) {
+            return false;
+        }
+        while (pos != end && !isBlank(*pos)) {
+            pos++;
+        }
+        return true;
+    }
+    // returns false if there is no line left
+    static bool nextLine(const char *&pos, const char *end, const char *&lineBegin, const char *&lineEnd);
+    static std::string illegalLine(const char *lineBegin, const char *lineEnd);
+
+private:
+    struct CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // CHUNKEDDIGRAPHREADER_H
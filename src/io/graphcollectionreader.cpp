@@ -0,0 +1,509 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graphcollectionreader.h"
+#include "sparsesixformat.h"
+#include "mappedfile.h"
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "pipe/digraphprocessor.h"
+#include "parallel/threadpool.h"
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <mutex>
+#include <stdexcept>
+
+namespace Algora {
+
+constexpr GraphCollectionReader::size_type GraphCollectionReader::DEFAULT_MAX_VERTICES;
+
+namespace {
+
+bool isPrintable(const char *begin, const char *end)
+{
+    for (const char *p = begin; p != end; p++) {
+        if (*p < 63 || *p > 126) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// per-thread buffers, kept across lines
+struct LineDecoder {
+    std::vector<Vertex*> vertices;
+    std::vector<DiGraph::ArcEndpoints> arcs;
+    unsigned long long maxVertices = GraphCollectionReader::DEFAULT_MAX_VERTICES;
+
+    bool decode(const char *begin, const char *end, DiGraph *graph);
+
+private:
+    bool decodeGraphSix(const char *pos, const char *end, DiGraph *graph);
+    bool decodeDigraphSix(const char *pos, const char *end, DiGraph *graph);
+    bool decodeSparseSix(const char *pos, const char *end, DiGraph *graph);
+
+    // vertex indices must fit into 32 bits
+    bool isAcceptedSize(unsigned long long n) const {
+        return n < (1ULL << 32) && n <= maxVertices;
+    }
+
+    void addVertices(DiGraph *graph, unsigned long long n) {
+        vertices.clear();
+        arcs.clear();
+        graph->addVertices(n, &vertices);
+    }
+};
+
+bool LineDecoder::decode(const char *begin, const char *end, DiGraph *graph)
+{
+    if (begin != end && *(end - 1) == '\r') {
+        end--;
+    }
+    if (end - begin >= 2 && begin[0] == '>' && begin[1] == '>') {
+        const char *p = begin + 2;
+        while (p + 1 < end && !(p[0] == '<' && p[1] == '<')) {
+            p++;
+        }
+        if (p + 1 >= end) {
+            return false;
+        }
+        begin = p + 2;
+    }
+    if (begin == end) {
+        return false;
+    }
+    DiGraph::UpdateBatch batch(graph);
+    // with a large maxVertices, the vertices may still not fit into memory
+    try {
+        switch (*begin) {
+        case ':':
+            return decodeSparseSix(begin + 1, end, graph);
+        case '&':
+            return decodeDigraphSix(begin + 1, end, graph);
+        case ';':
+            // incremental sparse6 refers to the previous graph
+            return false;
+        default:
+            return decodeGraphSix(begin, end, graph);
+        }
+    } catch (const std::bad_alloc &) {
+        vertices.clear();
+        arcs.clear();
+        return false;
+    }
+}
+
+bool LineDecoder::decodeGraphSix(const char *pos, const char *end, DiGraph *graph)
+{
+    unsigned long long n;
+    if (!decodeSparseSixN(pos, end, n) || !isAcceptedSize(n) || !isPrintable(pos, end)) {
+        return false;
+    }
+    unsigned long long numBits = n * (n - 1ULL) / 2ULL;
+    if (static_cast<unsigned long long>(end - pos) != (numBits + 5ULL) / 6ULL) {
+        return false;
+    }
+    addVertices(graph, n);
+    // upper triangle, column by column
+    unsigned long long i = 0ULL, j = 1ULL;
+    for (; pos != end; pos++) {
+        unsigned int c = static_cast<unsigned int>(*pos - 63);
+        for (int b = 5; b >= 0 && j < n; b--) {
+            if ((c >> b) & 1U) {
+                arcs.emplace_back(vertices[i], vertices[j]);
+            }
+            if (++i == j) {
+                i = 0ULL;
+                j++;
+            }
+        }
+    }
+    graph->addArcs(arcs);
+    return true;
+}
+
+bool LineDecoder::decodeDigraphSix(const char *pos, const char *end, DiGraph *graph)
+{
+    unsigned long long n;
+    if (!decodeSparseSixN(pos, end, n) || !isAcceptedSize(n) || !isPrintable(pos, end)) {
+        return false;
+    }
+    if (static_cast<unsigned long long>(end - pos) != (n * n + 5ULL) / 6ULL) {
+        return false;
+    }
+    addVertices(graph, n);
+    // full matrix, row by row
+    unsigned long long i = 0ULL, j = 0ULL;
+    for (; pos != end; pos++) {
+        unsigned int c = static_cast<unsigned int>(*pos - 63);
+        for (int b = 5; b >= 0 && i < n; b--) {
+            if ((c >> b) & 1U) {
+                arcs.emplace_back(vertices[i], vertices[j]);
+            }
+            if (++j == n) {
+                j = 0ULL;
+                i++;
+            }
+        }
+    }
+    graph->addArcs(arcs);
+    return true;
+}
+
+bool LineDecoder::decodeSparseSix(const char *pos, const char *end, DiGraph *graph)
+{
+    const char *edgesEnd = static_cast<const char*>(std::memchr(pos, ':', static_cast<size_t>(end - pos)));
+    bool directed = edgesEnd != nullptr;
+    if (!directed) {
+        edgesEnd = end;
+    }
+    unsigned long long n;
+    // unlike for graph6, the line length does not bound n, as isolated vertices take no bits
+    if (!decodeSparseSixN(pos, edgesEnd, n) || !isAcceptedSize(n) || !isPrintable(pos, edgesEnd)
+            || (directed && !isPrintable(edgesEnd + 1, end))) {
+        return false;
+    }
+    unsigned int k = 1U;
+    while (k < 63U && (1ULL << k) < n) k++;
+    addVertices(graph, n);
+
+    SparseSixBitReader edgeBits(pos, edgesEnd);
+    SparseSixBitReader directionBits(directed ? edgesEnd + 1 : end, end);
+    unsigned long long cur = 0ULL;
+    while (edgeBits.getRemainingBits() > k) {
+        bool b = edgeBits.readBit();
+        unsigned long long x = edgeBits.readBits(k);
+        if (b) {
+            cur++;
+        }
+        if (x >= n || cur >= n) {
+            break;
+        } else if (x > cur) {
+            cur = x;
+        } else if (!directed) {
+            arcs.emplace_back(vertices[x], vertices[cur]);
+        } else if (directionBits.getRemainingBits() == 0ULL) {
+            return false;
+        } else if (directionBits.readBit()) {
+            arcs.emplace_back(vertices[cur], vertices[x]);
+        } else {
+            arcs.emplace_back(vertices[x], vertices[cur]);
+        }
+    }
+    graph->addArcs(arcs);
+    return true;
+}
+
+// splits [pos, end) at the next line break; returns false if there is none left
+bool nextLine(const char *&pos, const char *end, const char *&lineBegin, const char *&lineEnd)
+{
+    if (pos == end) {
+        return false;
+    }
+    lineBegin = pos;
+    lineEnd = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+    if (lineEnd) {
+        pos = lineEnd + 1;
+    } else {
+        lineEnd = end;
+        pos = end;
+    }
+    return true;
+}
+
+bool isBlank(const char *begin, const char *end)
+{
+    return begin == end || (end - begin == 1 && *begin == '\r');
+}
+
+}
+
+struct GraphCollectionReader::CheshireCat {
+    std::istream *input;
+    std::unique_ptr<std::ifstream> ownInput;
+
+    MappedFile mappedFile;
+    const char *bufferPos;
+    const char *bufferEnd;
+
+    size_type chunkSize;
+    std::mutex fetchMutex;
+
+    // current chunk of provideDiGraph()
+    std::string chunk;
+    const char *chunkPos;
+    const char *chunkEnd;
+    LineDecoder decoder;
+
+    std::atomic<size_type> numErrors;
+
+    unsigned numThreads;
+    ThreadPool *pool;
+    std::unique_ptr<ThreadPool> ownPool;
+
+    CheshireCat()
+        : input(nullptr), bufferPos(nullptr), bufferEnd(nullptr),
+          chunkSize(1U << 16), chunkPos(nullptr), chunkEnd(nullptr), numErrors(0U),
+          numThreads(0U), pool(nullptr) { }
+
+    void resetInput() {
+        mappedFile.close();
+        ownInput.reset();
+        input = nullptr;
+        bufferPos = bufferEnd = nullptr;
+        chunk.clear();
+        chunkPos = chunkEnd = nullptr;
+    }
+
+    // Hands out the next chunk of complete lines, either in place or copied into storage.
+    bool fetchChunk(std::string &storage, const char *&begin, const char *&end) {
+        std::lock_guard<std::mutex> lock(fetchMutex);
+        if (bufferPos != bufferEnd) {
+            begin = bufferPos;
+            if (static_cast<size_type>(bufferEnd - bufferPos) <= chunkSize) {
+                end = bufferEnd;
+            } else {
+                const char *p = bufferPos + chunkSize;
+                end = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(bufferEnd - p)));
+                end = end ? end + 1 : bufferEnd;
+            }
+            bufferPos = end;
+            return true;
+        }
+        if (!input || !input->good()) {
+            return false;
+        }
+        storage.resize(chunkSize);
+        input->read(&storage[0], static_cast<std::streamsize>(chunkSize));
+        storage.resize(static_cast<size_t>(input->gcount()));
+        if (input->good() && !storage.empty() && storage.back() != '\n') {
+            std::string rest;
+            std::getline(*input, rest);
+            storage.append(rest);
+        }
+        if (storage.empty()) {
+            return false;
+        }
+        begin = storage.data();
+        end = begin + storage.size();
+        return true;
+    }
+
+    // moves to the next non-blank line of the current chunk
+    bool skipBlankLines() {
+        while (true) {
+            const char *p = chunkPos;
+            const char *lineBegin, *lineEnd;
+            while (nextLine(p, chunkEnd, lineBegin, lineEnd)) {
+                if (!isBlank(lineBegin, lineEnd)) {
+                    return true;
+                }
+                chunkPos = p;
+            }
+            if (!fetchChunk(chunk, chunkPos, chunkEnd)) {
+                chunkPos = chunkEnd = nullptr;
+                return false;
+            }
+        }
+    }
+
+    ThreadPool &threadPool() {
+        if (pool) {
+            return *pool;
+        }
+        if (!ownPool) {
+            ownPool.reset(new ThreadPool(numThreads));
+        }
+        return *ownPool;
+    }
+
+    template<typename Process>
+    size_type processChunk(const char *pos, const char *end, LineDecoder &lineDecoder,
+                           IncidenceListGraph &graph, const Process &process) {
+        size_type numGraphs = 0U;
+        const char *lineBegin, *lineEnd;
+        while (nextLine(pos, end, lineBegin, lineEnd)) {
+            if (isBlank(lineBegin, lineEnd)) {
+                continue;
+            }
+            graph.clear();
+            if (lineDecoder.decode(lineBegin, lineEnd, &graph)) {
+                process(&graph);
+                numGraphs++;
+            } else {
+                numErrors++;
+            }
+        }
+        return numGraphs;
+    }
+};
+
+GraphCollectionReader::GraphCollectionReader(std::istream *input)
+    : grin(new CheshireCat)
+{
+    grin->input = input;
+}
+
+GraphCollectionReader::~GraphCollectionReader()
+{
+    delete grin;
+}
+
+void GraphCollectionReader::setInputStream(std::istream *input)
+{
+    grin->resetInput();
+    grin->input = input;
+}
+
+void GraphCollectionReader::setInputBuffer(const char *begin, const char *end)
+{
+    grin->resetInput();
+    grin->bufferPos = begin;
+    grin->bufferEnd = end;
+}
+
+bool GraphCollectionReader::openFile(const std::string &fileName)
+{
+    grin->resetInput();
+    if (grin->mappedFile.open(fileName)) {
+        grin->bufferPos = grin->mappedFile.begin();
+        grin->bufferEnd = grin->mappedFile.end();
+        return true;
+    }
+    grin->ownInput.reset(new std::ifstream(fileName, std::ios::binary));
+    if (!grin->ownInput->is_open()) {
+        grin->ownInput.reset();
+        return false;
+    }
+    grin->input = grin->ownInput.get();
+    return true;
+}
+
+void GraphCollectionReader::setNumThreads(unsigned n)
+{
+    grin->numThreads = n;
+    grin->ownPool.reset();
+}
+
+void GraphCollectionReader::useThreadPool(ThreadPool *threadPool)
+{
+    grin->pool = threadPool;
+}
+
+void GraphCollectionReader::setChunkSize(size_type bytes)
+{
+    grin->chunkSize = bytes > 0U ? bytes : 1U;
+}
+
+void GraphCollectionReader::setMaxVertices(size_type n)
+{
+    grin->decoder.maxVertices = n;
+}
+
+GraphCollectionReader::size_type GraphCollectionReader::processAll(DiGraphProcessor *processor)
+{
+    IncidenceListGraph graph;
+    auto process = [processor](DiGraph *g) { processor->processGraph(g); };
+    size_type numGraphs = grin->processChunk(grin->chunkPos, grin->chunkEnd, grin->decoder, graph, process);
+    grin->chunkPos = grin->chunkEnd = nullptr;
+    const char *begin, *end;
+    while (grin->fetchChunk(grin->chunk, begin, end)) {
+        numGraphs += grin->processChunk(begin, end, grin->decoder, graph, process);
+    }
+    return numGraphs;
+}
+
+GraphCollectionReader::size_type GraphCollectionReader::processAll(const std::vector<DiGraphProcessor*> &processors)
+{
+    if (processors.empty()) {
+        throw std::invalid_argument("At least one processor is required.");
+    }
+    ThreadPool &threadPool = grin->threadPool();
+    if (processors.size() < threadPool.getNumThreads()) {
+        throw std::invalid_argument("There must be a processor for each thread.");
+    }
+    std::atomic<size_type> numGraphs(0U);
+    {
+        IncidenceListGraph graph;
+        DiGraphProcessor *processor = processors.front();
+        numGraphs += grin->processChunk(grin->chunkPos, grin->chunkEnd, grin->decoder, graph,
+                                        [processor](DiGraph *g) { processor->processGraph(g); });
+        grin->chunkPos = grin->chunkEnd = nullptr;
+    }
+    threadPool.run([&](unsigned t) {
+        IncidenceListGraph graph;
+        LineDecoder lineDecoder;
+        lineDecoder.maxVertices = grin->decoder.maxVertices;
+        std::string storage;
+        DiGraphProcessor *processor = processors[t];
+        auto process = [processor](DiGraph *g) { processor->processGraph(g); };
+        size_type count = 0U;
+        const char *begin, *end;
+        while (grin->fetchChunk(storage, begin, end)) {
+            count += grin->processChunk(begin, end, lineDecoder, graph, process);
+        }
+        numGraphs += count;
+    });
+    return numGraphs;
+}
+
+GraphCollectionReader::size_type GraphCollectionReader::getNumErrors() const
+{
+    return grin->numErrors;
+}
+
+bool GraphCollectionReader::decodeLine(const char *begin, const char *end, DiGraph *graph,
+                                       size_type maxVertices)
+{
+    LineDecoder lineDecoder;
+    lineDecoder.maxVertices = maxVertices;
+    return lineDecoder.decode(begin, end, graph);
+}
+
+bool GraphCollectionReader::isGraphAvailable()
+{
+    return grin->skipBlankLines();
+}
+
+bool GraphCollectionReader::provideDiGraph(DiGraph *graph)
+{
+    if (!grin->skipBlankLines()) {
+        return false;
+    }
+    const char *lineBegin, *lineEnd;
+    if (!nextLine(grin->chunkPos, grin->chunkEnd, lineBegin, lineEnd)) {
+        return false;
+    }
+    if (!grin->decoder.decode(lineBegin, lineEnd, graph)) {
+        grin->numErrors++;
+        std::cerr << "io: Malformed graph: " << std::string(lineBegin, lineEnd) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef GRAPHCOLLECTIONREADER_H
+#define GRAPHCOLLECTIONREADER_H
+
+#include "pipe/digraphprovider.h"
+#include "graph/digraph.h"
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace Algora {
+
+class DiGraphProcessor;
+class ThreadPool;
+
+/**
+ * Reads collections of small graphs as written by nauty (geng, directg, ...),
+ * one graph per line in graph6, digraph6 or sparse6 format.
+ * The format is recognized per line; optional ">>graph6<<"-style headers are skipped.
+ * An undirected edge {i, j} with i < j becomes the arc (i, j);
+ * sparse6 lines with direction bits as written by SparseSixGraphRW keep their orientation.
+ * Regular files are memory-mapped where possible, streams are read in large blocks,
+ * and lines are decoded in place.
+ */
+class GraphCollectionReader : public DiGraphProvider
+{
+public:
+    typedef DiGraph::size_type size_type;
+    static constexpr size_type DEFAULT_MAX_VERTICES = 1U << 24;
+
+    explicit GraphCollectionReader(std::istream *input = nullptr);
+    virtual ~GraphCollectionReader() override;
+
+    GraphCollectionReader(const GraphCollectionReader &other) = delete;
+    GraphCollectionReader &operator=(const GraphCollectionReader &other) = delete;
+
+    void setInputStream(std::istream *input);
+    // the buffer is not copied and must outlive the reader
+    void setInputBuffer(const char *begin, const char *end);
+    // returns false if the file cannot be opened
+    bool openFile(const std::string &fileName);
+
+    // 0 uses all hardware threads
+    void setNumThreads(unsigned n);
+    // use an external pool instead of an own one; nullptr reverts to an own pool
+    void useThreadPool(ThreadPool *threadPool);
+    // approximate number of bytes a thread reads at once; chunks always end at a line break
+    void setChunkSize(size_type bytes);
+    // lines announcing more vertices count as malformed;
+    // this is checked before the graph is built
+    void setMaxVertices(size_type n);
+
+    // Reads all remaining graphs and passes each of them to processor.
+    // Returns the number of graphs processed.
+    size_type processAll(DiGraphProcessor *processor);
+    // Reads all remaining graphs in parallel; thread t passes its graphs to processors[t].
+    // There must be at least as many processors as threads.
+    // Graphs are not processed in input order.
+    size_type processAll(const std::vector<DiGraphProcessor*> &processors);
+
+    // number of malformed lines skipped so far
+    size_type getNumErrors() const;
+
+    // Decodes a single line (without line break) into graph, which should be empty.
+    // Returns false if the line is malformed.
+    static bool decodeLine(const char *begin, const char *end, DiGraph *graph,
+                           size_type maxVertices = DEFAULT_MAX_VERTICES);
+
+    // DiGraphProvider interface
+public:
+    virtual bool isGraphAvailable() override;
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    struct CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // GRAPHCOLLECTIONREADER_H
@@ -31,7 +31,17 @@ HEADERS += \
     $$PWD/sparsesixgraphrw.h \
     $$PWD/sparsesixformat.h \
     $$PWD/adjacencymatrixrw.h \
-    $$PWD/linearvertexsequencetikzwriter.h
+    $$PWD/linearvertexsequencetikzwriter.h \
+    $$PWD/graphcollectionreader.h \
+    $$PWD/mappedfile.h \
+    $$PWD/chunkeddigraphreader.h \
+    $$PWD/snapedgelistreader.h \
+    $$PWD/metisgraphreader.h \
+    $$PWD/matrixmarketreader.h \
+    $$PWD/binarygraphformat.h \
+    $$PWD/binarygraphwriter.h \
+    $$PWD/binarygraphreader.h \
+    $$PWD/binarygraphview.h
 
 SOURCES += \     
     $$PWD/adjacencyliststringwriter.cpp \
@@ -39,4 +49,13 @@ SOURCES += \
     $$PWD/sparsesixgraphrw.cpp \
     $$PWD/sparsesixformat.cpp \
     $$PWD/adjacencymatrixrw.cpp \
-    $$PWD/linearvertexsequencetikzwriter.cpp
+    $$PWD/linearvertexsequencetikzwriter.cpp \
+    $$PWD/graphcollectionreader.cpp \
+    $$PWD/mappedfile.cpp \
+    $$PWD/chunkeddigraphreader.cpp \
+    $$PWD/snapedgelistreader.cpp \
+    $$PWD/metisgraphreader.cpp \
+    $$PWD/matrixmarketreader.cpp \
+    $$PWD/binarygraphwriter.cpp \
+    $$PWD/binarygraphreader.cpp \
+    $$PWD/binarygraphview.cpp
@@ -0,0 +1,79 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "mappedfile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ALGORA_HAVE_MMAP
+#endif
+
+namespace Algora {
+
+bool MappedFile::open(const std::string &fileName)
+{
+    close();
+#ifdef ALGORA_HAVE_MMAP
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+    if (st.st_size > 0) {
+        void *m = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        madvise(m, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+        mapping = m;
+        mappingSize = static_cast<std::size_t>(st.st_size);
+    }
+    ::close(fd);
+    isOpen = true;
+    return true;
+#else
+    (void) fileName;
+    return false;
+#endif
+}
+
+void MappedFile::close()
+{
+#ifdef ALGORA_HAVE_MMAP
+    if (mapping) {
+        munmap(mapping, mappingSize);
+    }
+#endif
+    mapping = nullptr;
+    mappingSize = 0U;
+    isOpen = false;
+}
+
+}
@@ -0,0 +1,62 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace Algora {
+
+/**
+ * Read-only memory mapping of a regular file.
+ * Mapping is only available on POSIX systems; callers should fall back
+ * to reading the file as a stream if open() fails.
+ */
+class MappedFile
+{
+public:
+    MappedFile() : mapping(nullptr), mappingSize(0U), isOpen(false) { }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile &other) = delete;
+    MappedFile &operator=(const MappedFile &other) = delete;
+
+    // returns false if the file does not exist, is not a regular file or cannot be mapped
+    bool open(const std::string &fileName);
+    void close();
+
+    bool isMapped() const { return isOpen; }
+    const char *begin() const { return static_cast<const char*>(mapping); }
+    const char *end() const { return begin() + mappingSize; }
+    std::size_t size() const { return mappingSize; }
+
+private:
+    void *mapping;
+    std::size_t mappingSize;
+    bool isOpen;
+};
+
+}
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,143 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "matrixmarketreader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+namespace Algora {
+
+namespace {
+
+std::string nextWord(const char *&pos, const char *end)
+{
+    while (pos != end && (*pos == ' ' || *pos == '\t')) {
+        pos++;
+    }
+    std::string word;
+    while (pos != end && *pos != ' ' && *pos != '\t') {
+        word.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(*pos))));
+        pos++;
+    }
+    return word;
+}
+
+}
+
+MatrixMarketReader::MatrixMarketReader(std::istream *input)
+    : ChunkedDiGraphReader(input), numRows(0U), numColumns(0U), numEntries(0U), mirrored(false)
+{
+
+}
+
+MatrixMarketReader::~MatrixMarketReader()
+{
+
+}
+
+const char *MatrixMarketReader::parseHeader(const char *begin, const char *end, std::string &error)
+{
+    const char *lineBegin, *lineEnd;
+    if (!nextLine(begin, end, lineBegin, lineEnd)) {
+        error = "Missing header.";
+        return nullptr;
+    }
+    const char *pos = lineBegin;
+    if (nextWord(pos, lineEnd) != "%%matrixmarket" || nextWord(pos, lineEnd) != "matrix") {
+        error = "Missing %%MatrixMarket banner.";
+        return nullptr;
+    }
+    if (nextWord(pos, lineEnd) != "coordinate") {
+        error = "Only coordinate format is supported.";
+        return nullptr;
+    }
+    std::string field = nextWord(pos, lineEnd);
+    if (field != "pattern" && field != "real" && field != "integer" && field != "complex") {
+        error = "Unknown field \"" + field + "\".";
+        return nullptr;
+    }
+    std::string symmetry = nextWord(pos, lineEnd);
+    if (symmetry == "general") {
+        mirrored = false;
+    } else if (symmetry == "symmetric" || symmetry == "skew-symmetric" || symmetry == "hermitian") {
+        mirrored = true;
+    } else {
+        error = "Unknown symmetry \"" + symmetry + "\".";
+        return nullptr;
+    }
+
+    do {
+        if (!nextLine(begin, end, lineBegin, lineEnd)) {
+            error = "Missing size line.";
+            return nullptr;
+        }
+    } while (skipBlanks(lineBegin, lineEnd) == lineEnd || *lineBegin == '%');
+    pos = lineBegin;
+    if (!parseIndex(pos, lineEnd, numRows) || !parseIndex(pos, lineEnd, numColumns)
+            || !parseIndex(pos, lineEnd, numEntries) || skipBlanks(pos, lineEnd) != lineEnd) {
+        error = "Illegal size line \"" + std::string(lineBegin, lineEnd) + "\".";
+        return nullptr;
+    }
+    return begin;
+}
+
+bool MatrixMarketReader::parseChunk(const char *begin, const char *end, size_type,
+                                    std::vector<IndexPair> &arcs, size_type &numLines, std::string &error) const
+{
+    arcs.reserve(static_cast<size_type>(end - begin) / (mirrored ? 6U : 12U));
+    numLines = 0U;
+    const char *lineBegin, *lineEnd;
+    while (nextLine(begin, end, lineBegin, lineEnd)) {
+        const char *pos = skipBlanks(lineBegin, lineEnd);
+        if (pos == lineEnd || *pos == '%') {
+            continue;
+        }
+        size_type i, j;
+        if (!parseIndex(pos, lineEnd, i) || !parseIndex(pos, lineEnd, j)
+                || i < 1U || i > numRows || j < 1U || j > numColumns) {
+            error = illegalLine(lineBegin, lineEnd);
+            return false;
+        }
+        arcs.emplace_back(i - 1U, j - 1U);
+        if (mirrored && i != j) {
+            arcs.emplace_back(j - 1U, i - 1U);
+        }
+        numLines++;
+    }
+    return true;
+}
+
+bool MatrixMarketReader::finish(size_type numLines, size_type, size_type, size_type &numVertices, std::string &error)
+{
+    if (numLines != numEntries) {
+        std::ostringstream stringStream;
+        stringStream << "Expected " << numEntries << " entries, found " << numLines << ".";
+        error = stringStream.str();
+        return false;
+    }
+    numVertices = std::max(numRows, numColumns);
+    return true;
+}
+
+}
@@ -0,0 +1,59 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef MATRIXMARKETREADER_H
+#define MATRIXMARKETREADER_H
+
+#include "chunkeddigraphreader.h"
+
+namespace Algora {
+
+/**
+ * Reads sparse matrices in Matrix Market coordinate format as digraphs:
+ * an entry (i, j) yields the arc (i - 1, j - 1), values are ignored.
+ * Symmetric, skew-symmetric and Hermitian matrices also yield the mirrored arc
+ * of every off-diagonal entry. The graph has max(rows, columns) vertices.
+ */
+class MatrixMarketReader : public ChunkedDiGraphReader
+{
+public:
+    explicit MatrixMarketReader(std::istream *input = nullptr);
+    virtual ~MatrixMarketReader() override;
+
+    // ChunkedDiGraphReader interface
+protected:
+    virtual const char *parseHeader(const char *begin, const char *end, std::string &error) override;
+    virtual bool parseChunk(const char *begin, const char *end, size_type firstLine,
+                            std::vector<IndexPair> &arcs, size_type &numLines, std::string &error) const override;
+    virtual bool finish(size_type numLines, size_type numArcs, size_type maxIndex,
+                        size_type &numVertices, std::string &error) override;
+
+private:
+    size_type numRows;
+    size_type numColumns;
+    size_type numEntries;
+    bool mirrored;
+};
+
+}
+
+#endif // MATRIXMARKETREADER_H
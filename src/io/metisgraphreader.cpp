@@ -0,0 +1,148 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "metisgraphreader.h"
+
+#include <sstream>
+
+namespace Algora {
+
+MetisGraphReader::MetisGraphReader(std::istream *input)
+    : ChunkedDiGraphReader(input), numVertices(0U), numEdges(0U),
+      hasVertexSizes(false), numVertexWeights(0U), hasEdgeWeights(false)
+{
+
+}
+
+MetisGraphReader::~MetisGraphReader()
+{
+
+}
+
+const char *MetisGraphReader::parseHeader(const char *begin, const char *end, std::string &error)
+{
+    const char *lineBegin, *lineEnd;
+    do {
+        if (!nextLine(begin, end, lineBegin, lineEnd)) {
+            error = "Missing header.";
+            return nullptr;
+        }
+    } while (lineBegin != lineEnd && *lineBegin == '%');
+
+    const char *pos = lineBegin;
+    if (!parseIndex(pos, lineEnd, numVertices) || !parseIndex(pos, lineEnd, numEdges)) {
+        error = "Illegal header \"" + std::string(lineBegin, lineEnd) + "\".";
+        return nullptr;
+    }
+    hasVertexSizes = false;
+    numVertexWeights = 0U;
+    hasEdgeWeights = false;
+    size_type fmt;
+    if (skipBlanks(pos, lineEnd) != lineEnd) {
+        const char *fmtBegin = skipBlanks(pos, lineEnd);
+        if (!parseIndex(pos, lineEnd, fmt) || pos - fmtBegin > 3) {
+            error = "Illegal format in header \"" + std::string(lineBegin, lineEnd) + "\".";
+            return nullptr;
+        }
+        // digits: vertex sizes, vertex weights, edge weights
+        std::string digits(fmtBegin, pos);
+        digits.insert(0U, 3U - digits.size(), '0');
+        if (digits.find_first_not_of("01") != std::string::npos) {
+            error = "Illegal format in header \"" + std::string(lineBegin, lineEnd) + "\".";
+            return nullptr;
+        }
+        hasVertexSizes = digits[0] == '1';
+        numVertexWeights = digits[1] == '1' ? 1U : 0U;
+        hasEdgeWeights = digits[2] == '1';
+        size_type ncon;
+        if (skipBlanks(pos, lineEnd) != lineEnd) {
+            if (!parseIndex(pos, lineEnd, ncon) || numVertexWeights == 0U) {
+                error = "Illegal number of vertex weights in header \"" + std::string(lineBegin, lineEnd) + "\".";
+                return nullptr;
+            }
+            numVertexWeights = ncon;
+        }
+    }
+    return begin;
+}
+
+bool MetisGraphReader::parseChunk(const char *begin, const char *end, size_type firstLine,
+                                  std::vector<IndexPair> &arcs, size_type &numLines, std::string &error) const
+{
+    arcs.reserve(static_cast<size_type>(end - begin) / 6U);
+    size_type v = firstLine;
+    const char *lineBegin, *lineEnd;
+    while (nextLine(begin, end, lineBegin, lineEnd)) {
+        if (!isDataLine(lineBegin, lineEnd)) {
+            continue;
+        }
+        if (v >= numVertices) {
+            // trailing blank lines are tolerated
+            if (skipBlanks(lineBegin, lineEnd) == lineEnd) {
+                continue;
+            }
+            std::ostringstream stringStream;
+            stringStream << "More than " << numVertices << " vertex lines.";
+            error = stringStream.str();
+            return false;
+        }
+        const char *pos = lineBegin;
+        bool ok = !hasVertexSizes || skipToken(pos, lineEnd);
+        for (size_type i = 0U; ok && i < numVertexWeights; i++) {
+            ok = skipToken(pos, lineEnd);
+        }
+        while (ok && skipBlanks(pos, lineEnd) != lineEnd) {
+            size_type w;
+            ok = parseIndex(pos, lineEnd, w) && w >= 1U && w <= numVertices
+                    && (!hasEdgeWeights || skipToken(pos, lineEnd));
+            if (ok) {
+                arcs.emplace_back(v, w - 1U);
+            }
+        }
+        if (!ok) {
+            error = illegalLine(lineBegin, lineEnd);
+            return false;
+        }
+        v++;
+    }
+    numLines = v - firstLine;
+    return true;
+}
+
+bool MetisGraphReader::finish(size_type numLines, size_type numArcs, size_type, size_type &n, std::string &error)
+{
+    std::ostringstream stringStream;
+    if (numLines != numVertices) {
+        stringStream << "Expected " << numVertices << " vertex lines, found " << numLines << ".";
+        error = stringStream.str();
+        return false;
+    }
+    if (numArcs != 2U * numEdges) {
+        stringStream << "Expected " << 2U * numEdges << " adjacencies, found " << numArcs << ".";
+        error = stringStream.str();
+        return false;
+    }
+    n = numVertices;
+    return true;
+}
+
+}
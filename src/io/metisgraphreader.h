@@ -0,0 +1,65 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef METISGRAPHREADER_H
+#define METISGRAPHREADER_H
+
+#include "chunkeddigraphreader.h"
+
+namespace Algora {
+
+/**
+ * Reads graphs in the METIS format: a header "n m [fmt [ncon]]" followed by
+ * one line per vertex listing its one-based neighbors; lines starting with '%' are comments.
+ * Vertex sizes and weights as well as edge weights are skipped.
+ * Every listed neighbor w of v yields the arc (v, w), so each undirected edge
+ * becomes a pair of antiparallel arcs.
+ */
+class MetisGraphReader : public ChunkedDiGraphReader
+{
+public:
+    explicit MetisGraphReader(std::istream *input = nullptr);
+    virtual ~MetisGraphReader() override;
+
+    // ChunkedDiGraphReader interface
+protected:
+    virtual const char *parseHeader(const char *begin, const char *end, std::string &error) override;
+    virtual bool parseChunk(const char *begin, const char *end, size_type firstLine,
+                            std::vector<IndexPair> &arcs, size_type &numLines, std::string &error) const override;
+    virtual bool finish(size_type numLines, size_type numArcs, size_type maxIndex,
+                        size_type &numVertices, std::string &error) override;
+    virtual bool needsLineNumbers() const override { return true; }
+    virtual bool isDataLine(const char *begin, const char *end) const override {
+        return begin == end || *begin != '%';
+    }
+
+private:
+    size_type numVertices;
+    size_type numEdges;
+    bool hasVertexSizes;
+    size_type numVertexWeights;
+    bool hasEdgeWeights;
+};
+
+}
+
+#endif // METISGRAPHREADER_H
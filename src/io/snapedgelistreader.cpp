@@ -0,0 +1,87 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "snapedgelistreader.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace Algora {
+
+SnapEdgeListReader::SnapEdgeListReader(std::istream *input, bool symmetric)
+    : ChunkedDiGraphReader(input), symmetric(symmetric)
+{
+
+}
+
+SnapEdgeListReader::~SnapEdgeListReader()
+{
+
+}
+
+const char *SnapEdgeListReader::parseHeader(const char *begin, const char *, std::string &)
+{
+    // comments may appear anywhere
+    return begin;
+}
+
+bool SnapEdgeListReader::parseChunk(const char *begin, const char *end, size_type,
+                                    std::vector<IndexPair> &arcs, size_type &numLines, std::string &error) const
+{
+    arcs.reserve(static_cast<size_type>(end - begin) / 8U);
+    numLines = 0U;
+    const size_type maxVertices = getMaxVertices();
+    const char *lineBegin, *lineEnd;
+    while (nextLine(begin, end, lineBegin, lineEnd)) {
+        const char *pos = skipBlanks(lineBegin, lineEnd);
+        if (pos == lineEnd || *pos == '#' || *pos == '%') {
+            continue;
+        }
+        size_type tail, head;
+        if (!parseIndex(pos, lineEnd, tail) || !parseIndex(pos, lineEnd, head)) {
+            error = illegalLine(lineBegin, lineEnd);
+            return false;
+        }
+        // ids must stay below the maximum, so that one more than the largest id cannot overflow
+        if (tail >= maxVertices || head >= maxVertices) {
+            std::ostringstream stringStream;
+            stringStream << "Vertex id " << std::max(tail, head) << " is out of range, at most "
+                         << maxVertices << " vertices are accepted.";
+            error = stringStream.str();
+            return false;
+        }
+        arcs.emplace_back(tail, head);
+        if (symmetric && tail != head) {
+            arcs.emplace_back(head, tail);
+        }
+        numLines++;
+    }
+    return true;
+}
+
+bool SnapEdgeListReader::finish(size_type, size_type, size_type maxIndex, size_type &numVertices, std::string &)
+{
+    numVertices = maxIndex;
+    return true;
+}
+
+}
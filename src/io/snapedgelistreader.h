@@ -0,0 +1,61 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef SNAPEDGELISTREADER_H
+#define SNAPEDGELISTREADER_H
+
+#include "chunkeddigraphreader.h"
+
+namespace Algora {
+
+/**
+ * Reads whitespace-separated edge lists as distributed by SNAP:
+ * one arc "tail head" per line, further columns are ignored,
+ * and lines starting with '#' or '%' are comments.
+ * Vertex ids are zero-based; the graph has one vertex more than the largest id.
+ * Ids of at least getMaxVertices() are rejected.
+ */
+class SnapEdgeListReader : public ChunkedDiGraphReader
+{
+public:
+    explicit SnapEdgeListReader(std::istream *input = nullptr, bool symmetric = false);
+    virtual ~SnapEdgeListReader() override;
+
+    // if set, each line "u v" with u != v also yields the arc (v, u)
+    void setSymmetric(bool s) { symmetric = s; }
+    bool isSymmetric() const { return symmetric; }
+
+    // ChunkedDiGraphReader interface
+protected:
+    virtual const char *parseHeader(const char *begin, const char *end, std::string &error) override;
+    virtual bool parseChunk(const char *begin, const char *end, size_type firstLine,
+                            std::vector<IndexPair> &arcs, size_type &numLines, std::string &error) const override;
+    virtual bool finish(size_type numLines, size_type numArcs, size_type maxIndex,
+                        size_type &numVertices, std::string &error) override;
+
+private:
+    bool symmetric;
+};
+
+}
+
+#endif // SNAPEDGELISTREADER_H
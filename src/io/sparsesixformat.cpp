@@ -35,36 +35,72 @@
 
 namespace Algora {
 
+bool encodeSparseSixN(unsigned long long n, std::string &out)
+{
+    SparseSixBitWriter writer(out);
+    if (n <= 62ULL) {
+        out.push_back(static_cast<char>(n + 63ULL));
+    } else if (n <= 258047ULL) {
+        out.push_back(126);
+        writer.writeBits(n, 18U);
+    } else if (n <= 68719476735ULL) {
+        out.push_back(126);
+        out.push_back(126);
+        writer.writeBits(n, 36U);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool decodeSparseSixN(const char *&pos, const char *end, unsigned long long &n)
+{
+    if (pos >= end) {
+        return false;
+    }
+    if (*pos != 126) {
+        n = static_cast<unsigned char>(*pos) - 63U;
+        pos++;
+        return n <= 62ULL;
+    }
+    if (end - pos < 4) {
+        return false;
+    }
+    if (pos[1] != 126) {
+        SparseSixBitReader reader(pos + 1, pos + 4);
+        n = reader.readBits(18U);
+        pos += 4;
+        return true;
+    }
+    if (end - pos < 8) {
+        return false;
+    }
+    SparseSixBitReader reader(pos + 2, pos + 8);
+    n = reader.readBits(36U);
+    pos += 8;
+    return true;
+}
+
 void sparseSixR(boost::dynamic_bitset<> &bits, std::vector<int> &result) {
-    unsigned int blocks = bits.size() / 6;
-    if (bits.size() > blocks * 6) {
-        blocks++;
-    }
-    PRINT_DEBUG( "blocks: " << blocks )
-    boost::dynamic_bitset<> bpad(bits);
-    bpad.resize(6 * blocks);
-    bpad <<= (6 * blocks - bits.size());
-    int resultStart = result.size();
-    splitAndConvertBitset(bpad, 6, result);
-    for (unsigned int i = resultStart; i < result.size(); i++) {
-        result[i] += 63;
+    std::string chars;
+    chars.reserve(bits.size() / 6 + 1);
+    SparseSixBitWriter writer(chars);
+    for (auto i = bits.size(); i > 0; i--) {
+        writer.writeBit(bits[i - 1]);
+    }
+    writer.finish(false);
+    for (char c : chars) {
+        result.push_back(c);
     }
 }
 
 void sparseSixN(unsigned long long n, std::vector<int> &result)
 {
-   if (n <= 62ull) {
-       result.push_back((int) n + 63);
-   } else if (n <= 258047ull) {
-        result.push_back(126);
-        boost::dynamic_bitset<> bits(18,n);
-        sparseSixR(bits, result);
-   } else if (n <= 68719476735ull) {
-        result.push_back(126);
-        result.push_back(126);
-        boost::dynamic_bitset<> bits(36,n);
-        sparseSixR(bits, result);
-   }
+    std::string chars;
+    encodeSparseSixN(n, chars);
+    for (char c : chars) {
+        result.push_back(c);
+    }
 }
 
 void printAscii(std::ostream &out, std::vector<int> &bytes)
@@ -94,27 +130,22 @@ void reverseBitset(boost::dynamic_bitset<> &bitset)
 {
     for (unsigned int i = 0; i < bitset.size() / 2; i++) {
         bool x = bitset[i];
-        bitset[i] = bitset[bitset.size() - i];
-        bitset[bitset.size() - i] = x;
+        bitset[i] = bitset[bitset.size() - 1 - i];
+        bitset[bitset.size() - 1 - i] = x;
     }
 }
 
 void splitAndConvertBitset(boost::dynamic_bitset<> &bitset, int chunkSize, std::vector<int> &result)
 {
     int blocks = bitset.size() / chunkSize;
-    boost::dynamic_bitset<> mask(bitset.size(), (1 << (chunkSize + 1) ) - 1); // 63 = 111111
-    mask <<= (blocks - 1) * chunkSize;
-    for (unsigned int i = blocks; i > 0; i--) {
-        PRINT_DEBUG( "mask: " << mask )
-        boost::dynamic_bitset<> chunk(bitset.size());
-        chunk = (bitset & mask) >> (i-1)*chunkSize;
-        chunk.resize(chunkSize);
-        int value = chunk.to_ulong();
+    for (int i = blocks; i > 0; i--) {
+        int value = 0;
+        for (int j = chunkSize; j > 0; j--) {
+            value = (value << 1) | (bitset[(i - 1) * chunkSize + j - 1] ? 1 : 0);
+        }
         result.push_back(value);
         PRINT_DEBUG( "value: " << value )
-        mask >>= chunkSize;
     }
-
 }
 
 void asciiToInts(std::istream &in, std::vector<int> &bytes, char breakAt)
@@ -130,58 +161,29 @@ void asciiToInts(std::istream &in, std::vector<int> &bytes, char breakAt)
 
 unsigned long long extractSparseSixN(std::vector<int> &bytes)
 {
-    if (bytes.size() < 1) {
-        return 0;
+    std::string chars;
+    for (auto i = 0U; i < bytes.size() && i < 8U; i++) {
+        chars.push_back(static_cast<char>(bytes[i]));
     }
-    PRINT_DEBUG( "first byte: " << bytes[0] )
-    if (bytes[0] != 126) {
-        int value = bytes[0] - 63;
-        PRINT_DEBUG( "value: " << value )
-        bytes.erase (bytes.begin());
-        return value;
-    } else if (bytes.size() < 4) {
+    const char *pos = chars.data();
+    unsigned long long n;
+    if (!decodeSparseSixN(pos, chars.data() + chars.size(), n)) {
         return 0;
     }
-    PRINT_DEBUG( "second byte: " << bytes[1] )
-    PRINT_DEBUG( "third byte: " << bytes[2] )
-    PRINT_DEBUG( "forth byte: " << bytes[3] )
-    if (bytes[1] != 126) {
-        boost::dynamic_bitset<> b1(6, bytes[1] - 63);
-        boost::dynamic_bitset<> b2(6, bytes[2] - 63);
-        boost::dynamic_bitset<> b3(6, bytes[3] - 63);
-        PRINT_DEBUG( "bits 1: " << b1 )
-        PRINT_DEBUG( "bits 2: " << b2 )
-        PRINT_DEBUG( "bits 3: " << b3 )
-        bytes.erase(bytes.begin(), bytes.begin()+4);
-        prependBitset(b1, b2);
-        PRINT_DEBUG( "bits 1+2: " << b1 )
-        prependBitset(b1, b3);
-        PRINT_DEBUG( "bits: " << b1 )
-        PRINT_DEBUG( "ulong: " << b1.to_ulong() )
-        return b1.to_ulong();
-    } else if (bytes.size() < 8) {
-        return 0;
-    }
-    boost::dynamic_bitset<> b1(6, bytes[2] - 63);
-    boost::dynamic_bitset<> b2(6, bytes[3] - 63);
-    boost::dynamic_bitset<> b3(6, bytes[4] - 63);
-    boost::dynamic_bitset<> b4(6, bytes[5] - 63);
-    boost::dynamic_bitset<> b5(6, bytes[6] - 63);
-    boost::dynamic_bitset<> b6(6, bytes[7] - 63);
-    bytes.erase (bytes.begin(), bytes.begin() + 8);
-    prependBitset(b1, b2);
-    prependBitset(b1, b3);
-    prependBitset(b1, b4);
-    prependBitset(b1, b5);
-    prependBitset(b1, b6);
-    return b1.to_ulong();
+    bytes.erase(bytes.begin(), bytes.begin() + (pos - chars.data()));
+    return n;
 }
 
 void bytesToBitset(std::vector<int> &bytes, boost::dynamic_bitset<> &bitset)
 {
-    for (int b : bytes) {
-        boost::dynamic_bitset<> bs(6, b - 63);
-        prependBitset(bitset, bs);
+    auto offset = 6 * bytes.size();
+    bitset.resize(bitset.size() + offset);
+    bitset <<= offset;
+    for (auto b : bytes) {
+        offset -= 6;
+        for (auto j = 0U; j < 6U; j++) {
+            bitset[offset + j] = ((b - 63) >> j) & 1;
+        }
     }
 }
 
@@ -202,4 +204,3 @@ void extractLeftMostKBits(boost::dynamic_bitset<> &bitset, unsigned int k, boost
 }
 
 }
-
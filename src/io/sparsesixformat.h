@@ -24,10 +24,97 @@
 #define SPARSESIXFORMAT_H
 
 #include <vector>
+#include <string>
 #include <boost/dynamic_bitset.hpp>
 
 namespace Algora {
 
+// Packs bits into printable sparse6 characters (6 bits each, offset 63),
+// most significant bit first, in a single forward pass.
+class SparseSixBitWriter
+{
+public:
+    explicit SparseSixBitWriter(std::string &out) : out(out), buffer(0U), numBuffered(0U) { }
+
+    void writeBit(bool b) {
+        buffer = (buffer << 1) | (b ? 1U : 0U);
+        if (++numBuffered == 6U) {
+            out.push_back(static_cast<char>(buffer + 63U));
+            buffer = 0U;
+            numBuffered = 0U;
+        }
+    }
+
+    // writes the k least significant bits of value, most significant first
+    void writeBits(unsigned long long value, unsigned int k) {
+        while (k > 0U) {
+            k--;
+            writeBit((value >> k) & 1ULL);
+        }
+    }
+
+    // number of bits needed to complete the current character
+    unsigned int getPadding() const { return numBuffered == 0U ? 0U : 6U - numBuffered; }
+
+    // completes the current character with the given bit
+    void finish(bool pad = false) {
+        while (numBuffered > 0U) {
+            writeBit(pad);
+        }
+    }
+
+private:
+    std::string &out;
+    unsigned int buffer;
+    unsigned int numBuffered;
+};
+
+// Reads bits from sparse6 characters, most significant bit first.
+class SparseSixBitReader
+{
+public:
+    SparseSixBitReader(const char *begin, const char *end)
+        : pos(begin), end(end), buffer(0U), numBuffered(0U) { }
+
+    unsigned long long getRemainingBits() const {
+        return static_cast<unsigned long long>(end - pos) * 6ULL + numBuffered;
+    }
+
+    // callers must check getRemainingBits() first
+    bool readBit() {
+        if (numBuffered == 0U) {
+            buffer = static_cast<unsigned int>(static_cast<unsigned char>(*pos++) - 63U) & 63U;
+            numBuffered = 6U;
+        }
+        numBuffered--;
+        return (buffer >> numBuffered) & 1U;
+    }
+
+    unsigned long long readBits(unsigned int k) {
+        unsigned long long value = 0ULL;
+        while (k > 0U) {
+            value = (value << 1) | (readBit() ? 1ULL : 0ULL);
+            k--;
+        }
+        return value;
+    }
+
+private:
+    const char *pos;
+    const char *end;
+    unsigned int buffer;
+    unsigned int numBuffered;
+};
+
+// Appends the sparse6 encoding of n; returns false if n is too large.
+bool encodeSparseSixN(unsigned long long n, std::string &out);
+
+// Decodes n and advances pos; returns false on malformed input.
+bool decodeSparseSixN(const char *&pos, const char *end, unsigned long long &n);
+
+// The following functions operate on dynamic_bitsets whose highest index
+// holds the first bit. They are kept for compatibility.
+
 void sparseSixR(boost::dynamic_bitset<> &bits, std::vector<int> &result);
 
 void sparseSixN(unsigned long long n, std::vector<int> &result);
@@ -26,12 +26,15 @@
 #include "graph/digraph.h"
 #include "graph/parallelarcsbundle.h"
 #include "property/propertymap.h"
+#include "property/fastpropertymap.h"
 #include "pipe/digraphinfo.h"
+#include "algorithm/digraphdispatch.h"
 
 #include <ostream>
-#include <cmath>
+#include <string>
 #include <tuple>
 #include <algorithm>
+#include <memory>
 
 #include <iostream>
 
@@ -66,25 +69,33 @@ void SparseSixGraphRW::processGraph(const DiGraph *graph, const DiGraphInfo *inf
         info = &defaultInfo;
     }
 
-    PropertyMap<int> vertexId(-1);
-    int i = 0;
-    info->mapVertices([&](Vertex *v) { vertexId[v] = i++; });
-
-    int n = ncGraph->getSize();
-    outputStream << ":";
-    std::vector<int> bytes;
-    sparseSixN(n, bytes);
-    printAscii(outputStream, bytes);
-    bytes.clear();
+    typedef unsigned long long index_type;
+    std::unique_ptr<ModifiableProperty<index_type>> vertexIdPtr;
+    if (hasCompactVertexIds(ncGraph)) {
+        vertexIdPtr.reset(new FastPropertyMap<index_type>(0ULL));
+    } else {
+        vertexIdPtr.reset(new PropertyMap<index_type>(0ULL));
+    }
+    ModifiableProperty<index_type> &vertexId = *vertexIdPtr;
+    index_type i = 0;
+    info->mapVertices([&](Vertex *v) { vertexId.setValue(v, i++); });
+
+    index_type n = ncGraph->getSize();
+    std::string line(":");
+    if (!encodeSparseSixN(n, line)) {
+        std::cerr << "io: Too many vertices for sparse6." << std::endl;
+        return;
+    }
 
-    std::vector<std::tuple<int,int,bool> > arcs;
+    std::vector<std::tuple<index_type, index_type, bool> > arcs;
+    arcs.reserve(ncGraph->getNumArcs(false));
     ArcMapping createTuple = [&](Arc *a) {
-        int h = vertexId[a->getHead()];
-        int t = vertexId[a->getTail()];
+        index_type h = vertexId(a->getHead());
+        index_type t = vertexId(a->getTail());
         if (h <= t) {
-            arcs.push_back(std::make_tuple(t, h, true));
+            arcs.emplace_back(t, h, true);
         } else {
-            arcs.push_back(std::make_tuple(h, t, false));
+            arcs.emplace_back(h, t, false);
         }
     };
 
@@ -98,70 +109,46 @@ void SparseSixGraphRW::processGraph(const DiGraph *graph, const DiGraphInfo *inf
     });
     std::sort(arcs.begin(), arcs.end());
 
-    int k = 1;
-    while ((1 << k) < n) k++; //ceil(log2(n));
+    unsigned int k = 1;
+    while ((1ULL << k) < n) k++; //ceil(log2(n));
     PRINT_DEBUG( "k: " << k )
-    boost::dynamic_bitset<> edgeBits;
-    boost::dynamic_bitset<> directionBits;
-
-    auto extendEdgeBits = [&](int w) {
-        edgeBits.resize(edgeBits.size() + k);
-        edgeBits <<= k;
-        boost::dynamic_bitset<> enc(edgeBits.size(), w);
-        edgeBits |= enc;
-    };
 
-    int cur = 0;
-    int v, u;
-    bool direction;
-    for (auto t : arcs) {
-        std::tie(v, u, direction) = t;
+    line.reserve(line.size() + (arcs.size() * (2 * k + 2)) / 6 + arcs.size() / 6 + 4);
+    std::string directions;
+    directions.reserve(arcs.size() / 6 + 1);
+    SparseSixBitWriter edgeBits(line);
+    SparseSixBitWriter directionBits(directions);
+
+    index_type cur = 0;
+    for (const auto &[v, u, direction] : arcs) {
         PRINT_DEBUG( "Processing (" << v << "," << u << "," << direction << ")" )
         if (v == cur) {
-            prependBitset(edgeBits, false);
-            extendEdgeBits(u);
+            edgeBits.writeBit(false);
+            edgeBits.writeBits(u, k);
         } else if (v == cur + 1) {
             cur++;
-            prependBitset(edgeBits, true);
-            extendEdgeBits(u);
+            edgeBits.writeBit(true);
+            edgeBits.writeBits(u, k);
         } else {
             cur = v;
-            prependBitset(edgeBits, true);
-            extendEdgeBits(v);
-            prependBitset(edgeBits, false);
-            extendEdgeBits(u);
+            edgeBits.writeBit(true);
+            edgeBits.writeBits(v, k);
+            edgeBits.writeBit(false);
+            edgeBits.writeBits(u, k);
         }
-        PRINT_DEBUG( edgeBits )
-        directionBits.push_back(direction);
+        directionBits.writeBit(direction);
     }
-    int pad = 6 - (edgeBits.size() % 6);
-    if (pad < 6) {
-        edgeBits.resize(edgeBits.size() + pad);
-        edgeBits <<= pad;
-        if (k < 6 && n == (1 << k) && pad > k && cur < n-1) {
-            edgeBits[pad - 1] = false;
-            for (int i = 0; i < pad - 1; i++) {
-                edgeBits[i] = true;
-            }
-        } else {
-            for (int i = 0; i < pad; i++) {
-                edgeBits[i] = true;
-            }
-        }
+    // padding must not be mistaken for another edge
+    if (k < 6 && n == (1ULL << k) && edgeBits.getPadding() > k && cur < n - 1) {
+        edgeBits.writeBit(false);
     }
-    // reverse direction bits
-    PRINT_DEBUG( "direction: " << directionBits )
-    reverseBitset(directionBits);
-    PRINT_DEBUG( "direction: " << directionBits )
-
-    PRINT_DEBUG( "edge bits: " << edgeBits )
-    sparseSixR(edgeBits, bytes);
-    printAscii(outputStream, bytes);
-    outputStream << ":";
-    bytes.clear();
-    sparseSixR(directionBits, bytes);
-    printAscii(outputStream, bytes);
-    outputStream << std::endl;
+    edgeBits.finish(true);
+    directionBits.finish(false);
+
+    line.push_back(':');
+    line.append(directions);
+    line.push_back('\n');
+    outputStream << line;
 }
 
 bool SparseSixGraphRW::provideDiGraph(DiGraph *graph)
@@ -170,56 +157,41 @@ bool SparseSixGraphRW::provideDiGraph(DiGraph *graph)
         return false;
     }
     std::istream &inputStream = *(StreamDiGraphReader::inputStream);
-    inputStream >> std::noskipws;
-    char colon = '\0';
-    inputStream >> colon;
-    PRINT_DEBUG( "1st colon: " << colon )
-    if (colon != ':') {
+    std::string line;
+    if (!std::getline(inputStream, line) || line.empty() || line[0] != ':') {
         std::cerr << "io: Missing first ':'." << std::endl;
         return false;
     }
-    std::vector<int> bytes;
-    std::vector<int> direction;
-    asciiToInts(inputStream, bytes, ':');
-    inputStream >> colon;
-    PRINT_DEBUG( "2nd colon: " << colon )
-    if (colon != ':') {
+    auto secondColon = line.find(':', 1);
+    if (secondColon == std::string::npos) {
         std::cerr << "io: Missing second ':'." << std::endl;
         return false;
     }
-    asciiToInts(inputStream, direction, '\n');
-    // try to read newline character
-    if (inputStream.peek() == std::char_traits<char>::to_int_type('\n')) {
-        char eol;
-        inputStream >> eol;
-        PRINT_DEBUG( "EOL: " << eol )
-        if (eol != '\n') {
-            std::cerr << "io: Huh? There should have been a newline character." << std::endl;
-        }
+    const char *pos = line.data() + 1;
+    const char *edgesEnd = line.data() + secondColon;
+
+    typedef unsigned long long index_type;
+    index_type n;
+    if (!decodeSparseSixN(pos, edgesEnd, n)) {
+        std::cerr << "io: Invalid number of vertices." << std::endl;
+        return false;
     }
-    int n = extractSparseSixN(bytes);
     PRINT_DEBUG( "n = " << n )
     unsigned int k = 1;
-    while ((1 << k) < n) k++;
+    while ((1ULL << k) < n) k++;
     PRINT_DEBUG( "k = " << k )
 
+    DiGraph::UpdateBatch batch(graph);
     std::vector<Vertex*> vertices;
-    for (int i = 0; i < n; i++) {
-        vertices.push_back(graph->addVertex());
-    }
-    boost::dynamic_bitset<> edgeBits;
-    boost::dynamic_bitset<> directionBits;
-    bytesToBitset(bytes, edgeBits);
-    bytesToBitset(direction, directionBits);
-
-    int cur = 0;
-    bool b;
-    boost::dynamic_bitset<> vBits;
-    int v;
-    while (edgeBits.size() > k) {
-        b = extractLeftMostBit(edgeBits);
-        extractLeftMostKBits(edgeBits, k, vBits);
-        v = vBits.to_ulong();
+    graph->addVertices(n, &vertices);
+    std::vector<DiGraph::ArcEndpoints> arcs;
+
+    SparseSixBitReader edgeBits(pos, edgesEnd);
+    SparseSixBitReader directionBits(edgesEnd + 1, line.data() + line.size());
+    index_type cur = 0;
+    while (edgeBits.getRemainingBits() > k) {
+        bool b = edgeBits.readBit();
+        index_type v = edgeBits.readBits(k);
         PRINT_DEBUG( b << " " << v )
         if (b) {
             cur++;
@@ -229,16 +201,21 @@ bool SparseSixGraphRW::provideDiGraph(DiGraph *graph)
         } else if (v > cur) {
             cur = v;
         } else {
-            bool d = extractLeftMostBit(directionBits);
-            if (d) {
-                graph->addArc(vertices.at(cur), vertices.at(v));
+            if (directionBits.getRemainingBits() == 0) {
+                std::cerr << "io: Missing direction bits." << std::endl;
+                graph->addArcs(arcs);
+                return false;
+            }
+            if (directionBits.readBit()) {
+                arcs.emplace_back(vertices[cur], vertices[v]);
                 PRINT_DEBUG( "(" << cur << "," << v << ")" )
             } else {
-                graph->addArc(vertices.at(v), vertices.at(cur));
+                arcs.emplace_back(vertices[v], vertices[cur]);
                 PRINT_DEBUG( "(" << v << "," << cur << ")" )
             }
         }
     }
+    graph->addArcs(arcs);
 
     return true;
 }
@@ -42,7 +42,8 @@ public:
     // DiGraphProvider interface
 public:
     virtual bool isGraphAvailable() override {
-        return inputStream != nullptr && inputStream->good() && inputStream->rdbuf()->in_avail() > 0;
+        return inputStream != nullptr && inputStream->good()
+                && inputStream->peek() != std::istream::traits_type::eof();
     }
 
 protected:
@@ -95,6 +95,183 @@ private:
     bool delayedRemovals;
 };
 
+/**
+ * Observable for single items that can deliver notifications in batches.
+ * Observers may provide a batch notification that receives a whole span of
+ * items at once; otherwise, they are notified item by item, immediately and
+ * in the order of the items.
+ * Between beginBatch() and endBatch(), notifications for batch observers are
+ * buffered and delivered as a single batch by endBatch() or by an explicit flush().
+ */
+template<typename T>
+class BatchObservable
+{
+public:
+    typedef typename std::function<void(T)> Notification;
+    typedef typename std::function<void(const T *items, std::size_t num)> BatchNotification;
+    BatchObservable() : notificationsInProgress(0U), delayedRemovals(false), batchLevel(0U) { }
+
+    BatchObservable(const BatchObservable &other) = delete;
+    BatchObservable& operator=(const BatchObservable &other) = delete;
+    BatchObservable(BatchObservable &&other) = default;
+    BatchObservable& operator=(BatchObservable &&other) = default;
+
+    void addObserver(void *id, const Notification &fun, bool delay = true) {
+        addObserver(id, fun, BatchNotification(), delay);
+    }
+
+    void addObserver(void *id, const Notification &fun, const BatchNotification &batchFun, bool delay = true) {
+        assert(fun || batchFun);
+        if (notificationsInProgress > 0 && delay) {
+            delayedAdditions.push_back({id, fun, batchFun});
+        } else {
+            observers.push_back({id, fun, batchFun});
+        }
+    }
+
+    void removeObserver(void *id, bool delay = true) {
+        auto i = observers.begin();
+        while (i != observers.end()) {
+            if (id == i->id) {
+                i->id = this;
+                break;
+            } else {
+                i++;
+            }
+        }
+        assert(i != observers.end()); // observer not found
+        if (notificationsInProgress == 0 || !delay) {
+            if (i + 1 != observers.end()) {
+                *i = std::move(observers.back());
+            }
+            observers.pop_back();
+        } else {
+            delayedRemovals = true;
+        }
+    }
+
+    void notifyObservers(T t) {
+        notifyObservers(&t, 1U);
+    }
+
+    void notifyObservers(const T *items, std::size_t num) {
+        if (observers.empty() || num == 0U) {
+            return;
+        }
+        if (batchLevel > 0) {
+            if (hasBatchObservers()) {
+                buffer.insert(buffer.end(), items, items + num);
+            }
+            deliver(items, num, true, false);
+        } else {
+            deliver(items, num, true, true);
+        }
+    }
+
+    void beginBatch() {
+        batchLevel++;
+    }
+
+    void endBatch() {
+        assert(batchLevel > 0);
+        batchLevel--;
+        if (batchLevel == 0) {
+            flush();
+        }
+    }
+
+    bool isBatching() const {
+        return batchLevel > 0;
+    }
+
+    // delivers all buffered notifications, even while batching
+    void flush() {
+        if (buffer.empty()) {
+            return;
+        }
+        std::vector<T> items;
+        items.swap(buffer);
+        deliver(items.data(), items.size(), false, true);
+    }
+
+    bool hasObservers() const {
+        return !observers.empty();
+    }
+
+    void clear() {
+        observers.clear();
+        buffer.clear();
+    }
+
+private:
+    struct Observer {
+        void *id;
+        Notification fun;
+        BatchNotification batchFun;
+    };
+
+    unsigned int notificationsInProgress;
+    std::vector<Observer> observers;
+    std::vector<Observer> delayedAdditions;
+    bool delayedRemovals;
+    unsigned int batchLevel;
+    std::vector<T> buffer;
+
+    bool hasBatchObservers() const {
+        for (const auto &o : observers) {
+            if (o.id != this && o.batchFun) {
+                return true;
+            }
+        }
+        for (const auto &o : delayedAdditions) {
+            if (o.batchFun) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void deliver(const T *items, std::size_t num, bool toItemObservers, bool toBatchObservers) {
+        // no concurrency support!
+        notificationsInProgress++;
+        if (toItemObservers) {
+            for (std::size_t i = 0U; i < num; i++) {
+                for (const auto &o : observers) {
+                    if (o.id != this && !o.batchFun) {
+                        o.fun(items[i]);
+                    }
+                }
+            }
+        }
+        if (toBatchObservers) {
+            for (const auto &o : observers) {
+                if (o.id != this && o.batchFun) {
+                    o.batchFun(items, num);
+                }
+            }
+        }
+        notificationsInProgress--;
+
+        if (notificationsInProgress == 0) {
+            if (!delayedAdditions.empty()) {
+                std::move(delayedAdditions.begin(), delayedAdditions.end(), std::back_inserter(observers));
+                delayedAdditions.clear();
+            }
+
+            if (delayedRemovals) {
+                for (auto i = 0U; i < observers.size(); i++) {
+                    if (observers[i].id == this) {
+                        observers[i] = std::move(observers.back());
+                        observers.pop_back();
+                        i--;
+                    }
+                }
+                delayedRemovals = false;
+            }
+        }
+    }
+};
+
 }
 
 #endif // OBSERVABLE_H
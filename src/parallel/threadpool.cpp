@@ -0,0 +1,117 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "threadpool.h"
+
+namespace Algora {
+
+ThreadPool::ThreadPool(unsigned numThreads)
+    : numThreads(numThreads), job(nullptr), generation(0ULL), pending(0U), shutdown(false)
+{
+    if (this->numThreads == 0U) {
+        this->numThreads = std::thread::hardware_concurrency();
+    }
+    if (this->numThreads == 0U) {
+        this->numThreads = 1U;
+    }
+    workers.reserve(this->numThreads - 1U);
+    for (unsigned t = 1U; t < this->numThreads; t++) {
+        workers.emplace_back(&ThreadPool::work, this, t);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        shutdown = true;
+    }
+    jobReady.notify_all();
+    for (auto &w : workers) {
+        w.join();
+    }
+}
+
+void ThreadPool::run(const std::function<void(unsigned)> &f)
+{
+    if (workers.empty()) {
+        f(0U);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &f;
+        pending = numThreads - 1U;
+        failure = nullptr;
+        generation++;
+    }
+    jobReady.notify_all();
+
+    execute(0U);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [this]() { return pending == 0U; });
+    job = nullptr;
+    if (failure) {
+        std::exception_ptr e = failure;
+        failure = nullptr;
+        std::rethrow_exception(e);
+    }
+}
+
+void ThreadPool::work(unsigned threadIndex)
+{
+    unsigned long long seen = 0ULL;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobReady.wait(lock, [this,seen]() { return shutdown || generation != seen; });
+            if (shutdown) {
+                return;
+            }
+            seen = generation;
+        }
+        execute(threadIndex);
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            last = --pending == 0U;
+        }
+        if (last) {
+            jobDone.notify_one();
+        }
+    }
+}
+
+void ThreadPool::execute(unsigned threadIndex)
+{
+    try {
+        (*job)(threadIndex);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!failure) {
+            failure = std::current_exception();
+        }
+    }
+}
+
+}
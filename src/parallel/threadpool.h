@@ -0,0 +1,93 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Algora {
+
+/**
+ * Fixed set of worker threads for fork-join parallelism.
+ * The calling thread takes part in every job as thread 0.
+ */
+class ThreadPool
+{
+public:
+    typedef std::size_t size_type;
+
+    // numThreads == 0 uses all hardware threads
+    explicit ThreadPool(unsigned numThreads = 0U);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &other) = delete;
+    ThreadPool &operator=(const ThreadPool &other) = delete;
+
+    unsigned getNumThreads() const { return numThreads; }
+
+    // Calls f(threadIndex) on every thread and waits until all calls have returned.
+    // The first exception thrown by any call is rethrown.
+    void run(const std::function<void(unsigned)> &f);
+
+    // Calls f(i) for each i in [begin, end); every thread handles one
+    // contiguous chunk, in ascending order of thread index.
+    template<typename F>
+    void parallelFor(size_type begin, size_type end, const F &f) {
+        run([begin,end,&f,this](unsigned t) {
+            for (size_type i = chunkBegin(begin, end, t), e = chunkBegin(begin, end, t + 1U);
+                 i < e; i++) {
+                f(i);
+            }
+        });
+    }
+
+    size_type chunkBegin(size_type begin, size_type end, unsigned threadIndex) const {
+        return begin + (end - begin) * threadIndex / numThreads;
+    }
+
+private:
+    unsigned numThreads;
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    const std::function<void(unsigned)> *job;
+    unsigned long long generation;
+    unsigned pending;
+    bool shutdown;
+    std::exception_ptr failure;
+
+    void work(unsigned threadIndex);
+    void execute(unsigned threadIndex);
+};
+
+}
+
+#endif // THREADPOOL_H
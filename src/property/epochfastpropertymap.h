@@ -0,0 +1,196 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef EPOCHFASTPROPERTYMAP_H
+#define EPOCHFASTPROPERTYMAP_H
+
+#include "modifiableproperty.h"
+#include "graph/graphartifact.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Algora {
+
+template<typename T>
+struct EpochBucket {
+    typedef std::uint32_t epoch_type;
+    static constexpr epoch_type MAX_EPOCH = std::numeric_limits<epoch_type>::max();
+
+    T value;
+    epoch_type epoch;
+};
+
+/**
+ * Variant of FastPropertyMap whose values carry an epoch stamp.
+ * resetAll() only advances the current epoch, so it takes constant time;
+ * entries with a stale stamp are read as the default value.
+ */
+template<typename T>
+class EpochFastPropertyMap : public ModifiableProperty<T>
+{
+public:
+    typedef EpochBucket<T> bucket_type;
+    typedef typename bucket_type::epoch_type epoch_type;
+    typedef typename std::vector<bucket_type>::size_type size_type;
+
+    EpochFastPropertyMap(const T &defaultValue = T(), const std::string &name = "",
+                         size_type capacity = 0)
+        : ModifiableProperty<T>(name), defaultValue(defaultValue), epoch(1U) {
+        buckets.assign(capacity, staleBucket());
+    }
+    virtual ~EpochFastPropertyMap() = default;
+
+    EpochFastPropertyMap(const EpochFastPropertyMap<T> &other) = default;
+    EpochFastPropertyMap &operator=(const EpochFastPropertyMap<T> &rhs) = default;
+    EpochFastPropertyMap(EpochFastPropertyMap<T> &&other) = default;
+    EpochFastPropertyMap &operator=(EpochFastPropertyMap<T> &&rhs) = default;
+
+    const T &getDefaultValue() const { return defaultValue; }
+
+    // also applies to all entries not set since the last reset
+    void setDefaultValue(const T &val) {
+        defaultValue = val;
+    }
+
+    void setValueAtId(GraphArtifact::id_type id, const T &value) {
+        enlarge(id);
+        buckets[id].value = value;
+        buckets[id].epoch = epoch;
+    }
+
+    virtual void setValue(const GraphArtifact *ga, const T &value) override {
+        auto id = ga->getId();
+        if (this->observable.hasObservers()) {
+            auto oldValue = getValueAtId(id);
+            setValueAtId(id, value);
+            this->updateObservers(ga, oldValue, value);
+        } else {
+            setValueAtId(id, value);
+        }
+    }
+
+    void resetAtId(GraphArtifact::id_type id) {
+        if (id < buckets.size()) {
+            buckets[id].epoch = 0U;
+        }
+    }
+
+    void resetToDefault(const GraphArtifact *ga) {
+        setValue(ga, defaultValue);
+    }
+
+    bool hasDefaultValue(const GraphArtifact *ga) {
+        return defaultValue == getValue(ga);
+    }
+
+    void fit() {
+        buckets.shrink_to_fit();
+    }
+
+    void resetAll(size_type capacity) {
+        buckets.assign(capacity, staleBucket());
+        epoch = 1U;
+        if (capacity == 0) {
+            fit();
+        }
+        this->updateObservers(nullptr, defaultValue, defaultValue);
+    }
+
+    // constant time, except once every MAX_EPOCH calls
+    void resetAll() {
+        if (epoch == bucket_type::MAX_EPOCH) {
+            resetAll(buckets.size());
+            return;
+        }
+        epoch++;
+        this->updateObservers(nullptr, defaultValue, defaultValue);
+    }
+
+    size_type size() const {
+        return buckets.size();
+    }
+
+    virtual T &operator[](const GraphArtifact *ga) override {
+        return (*this)[ga->getId()];
+    }
+
+    const T &operator[](const GraphArtifact *ga) const {
+        auto id = ga->getId();
+        if (id < buckets.size() && buckets[id].epoch == epoch) {
+            return buckets[id].value;
+        }
+        return defaultValue;
+    }
+
+    T &operator[](GraphArtifact::id_type id) {
+        enlarge(id);
+        bucket_type &b = buckets[id];
+        if (b.epoch != epoch) {
+            b.value = defaultValue;
+            b.epoch = epoch;
+        }
+        return b.value;
+    }
+
+    T getValueAtId(GraphArtifact::id_type id) const {
+        if (id < buckets.size() && buckets[id].epoch == epoch) {
+            return buckets[id].value;
+        }
+        return defaultValue;
+    }
+
+    // Property interface
+public:
+    virtual T getValue(const GraphArtifact *ga) const override {
+        return getValueAtId(ga->getId());
+    }
+
+    virtual void setAll(const T &val) override {
+        setDefaultValue(val);
+        resetAll();
+    }
+
+private:
+    void enlarge(size_type size) {
+        if (size < buckets.size()) {
+            return;
+        }
+        buckets.resize(size + 1, staleBucket());
+    }
+
+    bucket_type staleBucket() const {
+        bucket_type b;
+        b.value = defaultValue;
+        b.epoch = 0U;
+        return b;
+    }
+
+    T defaultValue;
+    epoch_type epoch;
+    typename std::vector<bucket_type> buckets;
+};
+
+}
+
+#endif // EPOCHFASTPROPERTYMAP_H
@@ -0,0 +1,141 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "fastbitpropertymap.h"
+
+namespace Algora {
+
+constexpr FastBitPropertyMap::size_type FastBitPropertyMap::npos;
+
+FastBitPropertyMap::FastBitPropertyMap(bool defaultValue, const std::string &name, size_type capacity)
+    : Property<bool>(name), defaultValue(defaultValue), numBits(0U), allDirty(false)
+{
+    resetAll(capacity);
+}
+
+void FastBitPropertyMap::setDefaultValue(bool val)
+{
+    if (val == defaultValue) {
+        return;
+    }
+    defaultValue = val;
+    if (!words.empty() && (numBits & 63U)) {
+        word_type tailMask = ~word_type(0U) << (numBits & 63U);
+        words.back() = (words.back() & ~tailMask) | (fill() & tailMask);
+    }
+    allDirty = true;
+    dirtyWords.clear();
+}
+
+void FastBitPropertyMap::resetAll(size_type capacity)
+{
+    numBits = capacity;
+    words.assign((capacity + 63U) >> 6, fill());
+    if (capacity == 0U) {
+        fit();
+    }
+    dirtyWords.clear();
+    allDirty = false;
+}
+
+void FastBitPropertyMap::resetAll()
+{
+    if (allDirty) {
+        words.assign(words.size(), fill());
+    } else {
+        for (size_type i : dirtyWords) {
+            words[i] = fill();
+        }
+    }
+    dirtyWords.clear();
+    allDirty = false;
+}
+
+FastBitPropertyMap::size_type FastBitPropertyMap::count() const
+{
+    size_type c = 0U;
+    size_type fullWords = numBits >> 6;
+    for (size_type i = 0U; i < fullWords; i++) {
+        c += static_cast<size_type>(__builtin_popcountll(words[i]));
+    }
+    if (numBits & 63U) {
+        word_type mask = (word_type(1U) << (numBits & 63U)) - 1U;
+        c += static_cast<size_type>(__builtin_popcountll(words[fullWords] & mask));
+    }
+    return c;
+}
+
+template<typename Op>
+void FastBitPropertyMap::combine(const FastBitPropertyMap &other, const Op &op)
+{
+    if (other.numBits > numBits) {
+        enlarge(other.numBits - 1U);
+    }
+    for (size_type i = 0U; i < words.size(); i++) {
+        words[i] = op(words[i], other.wordAt(i));
+    }
+    if (numBits & 63U) {
+        word_type tailMask = ~word_type(0U) << (numBits & 63U);
+        words.back() = (words.back() & ~tailMask) | (fill() & tailMask);
+    }
+    allDirty = true;
+    dirtyWords.clear();
+}
+
+FastBitPropertyMap &FastBitPropertyMap::unite(const FastBitPropertyMap &other)
+{
+    combine(other, [](word_type a, word_type b) { return a | b; });
+    return *this;
+}
+
+FastBitPropertyMap &FastBitPropertyMap::intersect(const FastBitPropertyMap &other)
+{
+    combine(other, [](word_type a, word_type b) { return a & b; });
+    return *this;
+}
+
+FastBitPropertyMap &FastBitPropertyMap::subtract(const FastBitPropertyMap &other)
+{
+    combine(other, [](word_type a, word_type b) { return a & ~b; });
+    return *this;
+}
+
+FastBitPropertyMap::size_type FastBitPropertyMap::findFirst(size_type from) const
+{
+    if (from >= numBits) {
+        return npos;
+    }
+    size_type i = from >> 6;
+    word_type w = words[i] & (~word_type(0U) << (from & 63U));
+    while (true) {
+        if (w) {
+            size_type id = (i << 6) + static_cast<size_type>(__builtin_ctzll(w));
+            return id < numBits ? id : npos;
+        }
+        if (++i >= words.size()) {
+            return npos;
+        }
+        w = words[i];
+    }
+}
+
+}
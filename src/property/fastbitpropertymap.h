@@ -0,0 +1,205 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef FASTBITPROPERTYMAP_H
+#define FASTBITPROPERTYMAP_H
+
+#include "property.h"
+#include "graph/graphartifact.h"
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace Algora {
+
+/**
+ * Boolean property indexed by artifact ids, storing one bit per id.
+ * Ids beyond size() have the default value.
+ * Words modified since the last reset are tracked, so that resetAll()
+ * only touches those unless many words have been modified.
+ */
+class FastBitPropertyMap : public Property<bool>
+{
+public:
+    typedef std::uint64_t word_type;
+    typedef std::vector<word_type>::size_type size_type;
+
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    // iterates over all ids < size() with value true
+    class const_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef GraphArtifact::id_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type *pointer;
+        typedef const value_type &reference;
+
+        const_iterator(const FastBitPropertyMap *map, size_type id) : map(map), id(id) { }
+        reference operator*() const { return id; }
+        const_iterator &operator++() { id = map->findNext(id); return *this; }
+        const_iterator operator++(int) { const_iterator it = *this; ++(*this); return it; }
+        bool operator==(const const_iterator &other) const { return id == other.id; }
+        bool operator!=(const const_iterator &other) const { return id != other.id; }
+
+    private:
+        const FastBitPropertyMap *map;
+        size_type id;
+    };
+
+    explicit FastBitPropertyMap(bool defaultValue = false, const std::string &name = "",
+                                size_type capacity = 0);
+    virtual ~FastBitPropertyMap() override = default;
+
+    FastBitPropertyMap(const FastBitPropertyMap &other) = default;
+    FastBitPropertyMap &operator=(const FastBitPropertyMap &rhs) = default;
+    FastBitPropertyMap(FastBitPropertyMap &&other) = default;
+    FastBitPropertyMap &operator=(FastBitPropertyMap &&rhs) = default;
+
+    bool getDefaultValue() const { return defaultValue; }
+    void setDefaultValue(bool val);
+
+    bool getValueAtId(GraphArtifact::id_type id) const {
+        if (id >= numBits) {
+            return defaultValue;
+        }
+        return (words[id >> 6] >> (id & 63U)) & 1U;
+    }
+
+    void setValueAtId(GraphArtifact::id_type id, bool value) {
+        enlarge(id);
+        word_type &w = words[id >> 6];
+        word_type mask = word_type(1U) << (id & 63U);
+        word_type nw = value ? (w | mask) : (w & ~mask);
+        if (nw != w) {
+            if (w == fill()) {
+                markDirty(id >> 6);
+            }
+            w = nw;
+        }
+    }
+
+    void setValue(const GraphArtifact *ga, bool value) {
+        setValueAtId(ga->getId(), value);
+    }
+
+    void resetAtId(GraphArtifact::id_type id) {
+        setValueAtId(id, defaultValue);
+    }
+
+    void resetToDefault(const GraphArtifact *ga) {
+        setValueAtId(ga->getId(), defaultValue);
+    }
+
+    bool hasDefaultValue(const GraphArtifact *ga) const {
+        return getValue(ga) == defaultValue;
+    }
+
+    void setAll(bool val) {
+        setDefaultValue(val);
+        resetAll();
+    }
+
+    void resetAll(size_type capacity);
+    void resetAll();
+
+    void fit() {
+        words.shrink_to_fit();
+    }
+
+    size_type size() const {
+        return numBits;
+    }
+
+    // number of ids < size() with value true
+    size_type count() const;
+
+    // bulk operations; ids beyond size() are treated as having the default value
+    FastBitPropertyMap &unite(const FastBitPropertyMap &other);
+    FastBitPropertyMap &intersect(const FastBitPropertyMap &other);
+    FastBitPropertyMap &subtract(const FastBitPropertyMap &other);
+
+    // smallest id >= from / > id with value true, or npos
+    size_type findFirst(size_type from = 0U) const;
+    size_type findNext(size_type id) const {
+        return findFirst(id + 1U);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, findFirst());
+    }
+    const_iterator end() const {
+        return const_iterator(this, npos);
+    }
+
+    // Property interface
+public:
+    virtual bool getValue(const GraphArtifact *ga) const override {
+        return getValueAtId(ga->getId());
+    }
+
+private:
+    bool defaultValue;
+    size_type numBits;
+    std::vector<word_type> words;
+    std::vector<size_type> dirtyWords;
+    bool allDirty;
+
+    word_type fill() const {
+        return defaultValue ? ~word_type(0U) : word_type(0U);
+    }
+
+    word_type wordAt(size_type i) const {
+        return i < words.size() ? words[i] : fill();
+    }
+
+    void enlarge(size_type id) {
+        if (id < numBits) {
+            return;
+        }
+        numBits = id + 1U;
+        size_type numWords = (numBits + 63U) >> 6;
+        if (numWords > words.size()) {
+            words.resize(numWords, fill());
+        }
+    }
+
+    void markDirty(size_type word) {
+        if (allDirty) {
+            return;
+        }
+        dirtyWords.push_back(word);
+        if (dirtyWords.size() > (words.size() >> 4)) {
+            allDirty = true;
+            dirtyWords.clear();
+        }
+    }
+
+    template<typename Op>
+    void combine(const FastBitPropertyMap &other, const Op &op);
+};
+
+}
+
+#endif // FASTBITPROPERTYMAP_H
@@ -29,8 +29,12 @@ HEADERS += \
     $$PWD/functionproperty.h \
     $$PWD/propertymap.h \
     $$PWD/propertycomparator.h \
-    $$PWD/fastpropertymap.h
+    $$PWD/fastpropertymap.h \
+    $$PWD/epochfastpropertymap.h \
+    $$PWD/fastbitpropertymap.h \
+    $$PWD/traversalpropertymap.h
 
 SOURCES += \
     $$PWD/graphartifactproperty.cpp \
-    $$PWD/fastpropertymap.cpp
+    $$PWD/fastpropertymap.cpp \
+    $$PWD/fastbitpropertymap.cpp
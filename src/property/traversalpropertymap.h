@@ -0,0 +1,53 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef TRAVERSALPROPERTYMAP_H
+#define TRAVERSALPROPERTYMAP_H
+
+#include "fastpropertymap.h"
+#include "epochfastpropertymap.h"
+#include "fastbitpropertymap.h"
+
+namespace Algora {
+
+// Property map type to use for traversal-local state of an algorithm
+// that has been instantiated with ModifiablePropertyType:
+// FastPropertyMap is replaced by EpochFastPropertyMap, or by
+// FastBitPropertyMap for flags.
+template<template<typename> class ModifiablePropertyType, typename T>
+struct TraversalPropertyMap {
+    typedef ModifiablePropertyType<T> type;
+};
+
+template<typename T>
+struct TraversalPropertyMap<FastPropertyMap, T> {
+    typedef EpochFastPropertyMap<T> type;
+};
+
+template<>
+struct TraversalPropertyMap<FastPropertyMap, bool> {
+    typedef FastBitPropertyMap type;
+};
+
+}
+
+#endif // TRAVERSALPROPERTYMAP_H
@@ -0,0 +1,76 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "algorithm.basic/incrementalweaklyconnectedcomponentsalgorithm.h"
+
+#include <iostream>
+#include <string>
+
+using namespace Algora;
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string &what)
+{
+	if (!condition) {
+		std::cerr << "FAILED: " << what << std::endl;
+		failures++;
+	}
+}
+
+}
+
+int main()
+{
+	IncidenceListGraph g;
+	auto u = g.addVertex();
+	auto v = g.addVertex();
+	auto w = g.addVertex();
+	g.addArc(u, v);
+
+	IncrementalWeaklyConnectedComponentsAlgorithm wcc;
+	wcc.setGraph(&g);
+	wcc.run();
+	check(wcc.sameComponent(u, v), "u and v are connected");
+	check(!wcc.sameComponent(u, w), "u and w are not connected");
+
+	g.addArc(w, v);
+	check(wcc.sameComponent(u, w), "u and w are connected after an insertion");
+
+	// vertices of another graph must not be mistaken for the first vertex of this one
+	IncidenceListGraph other;
+	auto x = other.addVertex();
+	auto y = other.addVertex();
+	check(!wcc.sameComponent(u, x), "a foreign vertex is not in the component of u");
+	check(!wcc.sameComponent(x, u), "u is not in the component of a foreign vertex");
+	check(!wcc.sameComponent(x, y), "foreign vertices are not in a common component");
+	check(!wcc.sameComponent(x, x), "a foreign vertex has no component");
+
+	if (failures > 0) {
+		return 1;
+	}
+	std::cout << "All tests passed." << std::endl;
+	return 0;
+}
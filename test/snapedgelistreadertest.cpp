@@ -0,0 +1,89 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "io/snapedgelistreader.h"
+
+#include <iostream>
+#include <string>
+
+using namespace Algora;
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string &what)
+{
+	if (!condition) {
+		std::cerr << "FAILED: " << what << std::endl;
+		failures++;
+	}
+}
+
+bool read(const std::string &input, IncidenceListGraph &g, std::string &error,
+          DiGraph::size_type maxVertices = SnapEdgeListReader::DEFAULT_MAX_VERTICES)
+{
+	SnapEdgeListReader reader;
+	reader.setMaxVertices(maxVertices);
+	reader.setInputBuffer(input.data(), input.data() + input.size());
+	bool ok = reader.provideDiGraph(&g);
+	error = reader.getLastError();
+	return ok;
+}
+
+}
+
+int main()
+{
+	std::string error;
+	{
+		IncidenceListGraph g;
+		check(read("# comment\n0 1\n1 2\n", g, error), "valid input is accepted");
+		check(g.getSize() == 3U && g.getNumArcs(true) == 2U, "valid input yields 3 vertices and 2 arcs");
+	}
+	{
+		// one more than the largest id must not wrap around
+		IncidenceListGraph g;
+		check(!read("0 1\n0 18446744073709551615\n", g, error), "id SIZE_MAX is rejected");
+		check(!error.empty(), "id SIZE_MAX is reported");
+		check(g.isEmpty(), "id SIZE_MAX leaves the graph unchanged");
+	}
+	{
+		IncidenceListGraph g;
+		check(!read("0 1\n1099511627776 0\n", g, error), "id beyond the default maximum is rejected");
+		check(!error.empty(), "id beyond the default maximum is reported");
+		check(g.isEmpty(), "id beyond the default maximum leaves the graph unchanged");
+	}
+	{
+		IncidenceListGraph g;
+		check(!read("0 1\n2 3\n", g, error, 3U), "id equal to a configured maximum is rejected");
+		check(g.isEmpty(), "id equal to a configured maximum leaves the graph unchanged");
+		check(read("0 1\n2 0\n", g, error, 3U), "ids below a configured maximum are accepted");
+	}
+
+	if (failures > 0) {
+		return 1;
+	}
+	std::cout << "All tests passed." << std::endl;
+	return 0;
+}